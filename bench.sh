@@ -0,0 +1,180 @@
+#!/bin/bash
+
+## Usage: ./bench.sh [name...]   (runs every benchmark when none is given)
+
+## Each benchmark prints its timings; one with a target also prints PASS
+## or FAIL, and the script exits 1 if any target was missed.
+
+## Available benchmarks:
+
+## glob : `echo` of a pattern over a 100k-entry directory, minus the
+##        cost of the same line without a glob. Target: under 100 ms.
+
+## startup : `echo exit | mysh` with 5000 inherited 100-byte variables,
+##           minus the same loop running /bin/true, per start.
+
+## pipesize : `yes | head -c 500000000 | wc -c` through mysh, with the
+##            default pipes and with `set pipesize=1m`, in MB/s.
+
+## group : 500 lines of `(a; b) > out` run without the subshell fork,
+##         against the same body forced into a subshell by a builtin.
+
+## env_view : mallocs charged to the environment lookup sites by 1000
+##            more lines of `echo $PATH`, `cd ~` or `cd -`, read from
+##            MYSH_ALLOC_STATS=1 memstats. Target: none.
+
+BENCH_DIR=/tmp/__mysh_bench
+BENCH_RUNS=5
+FAILED=0
+LOOKUP_SITES="env_view|my_getenv_index|var_ref|cmd_lookup|my_cd|cd_minus"
+
+benchmarks()
+{
+    for name in ${@:-glob startup pipesize group env_view}
+    do
+        printf "\n%s\n-----\n" "$name"
+        if ! declare -F bench_$name > /dev/null; then
+            echo "Unknown benchmark."
+            FAILED=1
+            continue
+        fi
+        bench_$name
+    done
+}
+
+bench_glob()
+{
+    local dir=$BENCH_DIR/glob
+    local with without
+
+    if [[ ! -f $dir/f100000.log ]]; then
+        mkdir -p $dir
+        (cd $dir && seq -f "f%06g.log" 1 100000 | xargs touch)
+    fi
+    with=$(best_of "cd $dir\necho *99.log > /dev/null")
+    without=$(best_of "cd $dir\necho f99.log > /dev/null")
+    echo "100000 entries, 1000 matches: $((with - without)) ms ($with ms total)"
+    expect_under $((with - without)) 100
+}
+
+bench_startup()
+{
+    local vars mysh true
+
+    vars=$(for i in $(seq 1 5000); do printf "BENCH_VAR%d=%0100d " $i 0; done)
+    mysh=$(env $vars bash -c "$(declare -f loop_ms); loop_ms 200 ./mysh")
+    true=$(env $vars bash -c "$(declare -f loop_ms); loop_ms 200 /bin/true")
+    echo "$(((mysh - true) * 1000 / 200)) us per start ($mysh ms for 200)"
+}
+
+## loop_ms <count> <program> : ms to feed `exit` to <program> <count> times
+loop_ms()
+{
+    local start=$(date +%s%N)
+
+    for i in $(seq 1 $1)
+    do
+        echo exit | $2 > /dev/null
+    done
+    echo $((($(date +%s%N) - start) / 1000000))
+}
+
+bench_pipesize()
+{
+    local line="yes | head -c 500000000 | wc -c"
+    local size ms
+
+    for size in default 256k 1m
+    do
+        if [[ $size == default ]]; then
+            ms=$(best_of "$line")
+        else
+            ms=$(best_of "set pipesize=$size\n$line")
+        fi
+        echo "$size: $((500000 / ms)) MB/s"
+    done
+}
+
+bench_group()
+{
+    local out=$BENCH_DIR/group.out
+    local forkless forked
+
+    mkdir -p $BENCH_DIR
+    forkless=$(best_of "$(repeat 500 "(/bin/true; /bin/true) > $out")")
+    forked=$(best_of "$(repeat 500 "(/bin/true; /bin/true; set x) > $out")")
+    echo "without the fork: $forkless ms, with it: $forked ms"
+}
+
+bench_env_view()
+{
+    local home=$BENCH_DIR/home
+    local line more
+
+    mkdir -p $home
+    for line in "echo \$PATH" "cd ~" "cd -"
+    do
+        more=$(($(lookup_mallocs 2000 "$line" $home) -
+            $(lookup_mallocs 1000 "$line" $home)))
+        echo "$line: $more mallocs in the lookup per 1000 lines"
+        expect_under $more 1
+    done
+}
+
+## lookup_mallocs <count> <line> <home> : mallocs that <count> runs of
+## <line> charge to LOOKUP_SITES
+lookup_mallocs()
+{
+    printf "$(repeat $1 "$2 > /dev/null")memstats\n" |
+        HOME=$3 MYSH_ALLOC_STATS=1 ./mysh 2> /dev/null |
+        awk -v sites="^  ($LOOKUP_SITES):" '$0 ~ sites { n += $2 }
+            END { print n + 0 }'
+}
+
+## repeat <count> <line> : <line> <count> times, joined by \n
+repeat()
+{
+    for i in $(seq 1 $1)
+    do
+        printf '%s\\n' "$2"
+    done
+}
+
+## best_of <lines> : fastest of BENCH_RUNS runs of mysh on <lines>, in ms
+best_of()
+{
+    local best=-1 start elapsed
+
+    for i in $(seq 1 $BENCH_RUNS)
+    do
+        start=$(date +%s%N)
+        printf "$1\n" | ./mysh > /dev/null 2>&1
+        elapsed=$((($(date +%s%N) - start) / 1000000))
+        if [[ $best == -1 || $elapsed -lt $best ]]; then
+            best=$elapsed
+        fi
+    done
+    echo $best
+}
+
+expect_under()
+{
+    if [[ $1 -lt $2 ]]; then
+        echo "PASS (target < $2)"
+    else
+        echo "FAIL (target < $2)"
+        FAILED=1
+    fi
+}
+
+cleanup()
+{
+    rm -rf $BENCH_DIR
+    exit $FAILED
+}
+
+trap cleanup 2
+
+make -s || exit 1
+benchmarks "$@"
+cleanup
@@ -19,7 +19,15 @@
                         (my_strcmp(input[0], "exit") != 0) &&\
                         (my_strcmp(input[0], "env") != 0) &&\
                         (my_strcmp(input[0], "setenv") != 0) &&\
-                        (my_strcmp(input[0], "unsetenv") != 0))
+                        (my_strcmp(input[0], "unsetenv") != 0) &&\
+                        (my_strcmp(input[0], "set") != 0) &&\
+                        (my_strcmp(input[0], "unset") != 0) &&\
+                        (my_strcmp(input[0], "alias") != 0) &&\
+                        (my_strcmp(input[0], "unalias") != 0) &&\
+                        (my_strcmp(input[0], "history") != 0) &&\
+                        (my_strcmp(input[0], "memstats") != 0) &&\
+                        (my_strcmp(input[0], "timeout") != 0) &&\
+                        (my_strcmp(input[0], "batch") != 0))
     #include <stdio.h>
     #include <stdlib.h>
     #include <unistd.h>
@@ -33,6 +41,60 @@
                             free(x);\
                             (x) = NULL;\
                         }
+    #define ALLOC_SET_MIN 1024
+    #define ALLOC_SET_MIX 0x9e3779b97f4a7c15UL
+    #define ALLOC_SITES 256
+    #define ALLOC_ENV "MYSH_ALLOC_STATS="
+
+    #define SB_INLINE 256
+    #define CHARSET_ALPHA 0
+    #define CHARSET_DIGIT 1
+    #define CHARSET_ALNUM 2
+    #define CHARSET_NAME 3
+    #define CHARSET_FILE 4
+    #define CHARSET_CLASSES 5
+    #define CHARSET_HAS(set, c) ((((set)->bits[(unsigned char)(c) >> 6]) >>\
+                                ((unsigned char)(c) & 63)) & 1)
+
+    typedef struct charset_s {
+        uint64_t bits[4];
+    } charset_t;
+
+    typedef struct strbuf_s {
+        char *str;
+        int len;
+        int cap;
+        char small[SB_INLINE];
+    } strbuf_t;
+
+    typedef struct alloc_header_s {
+        int site;
+        size_t size;
+    } alloc_header_t;
+
+    typedef struct alloc_count_s {
+        long allocs;
+        long frees;
+        long bytes;
+        long live;
+        long peak;
+    } alloc_count_t;
+
+    typedef struct alloc_site_s {
+        char const *file;
+        alloc_count_t count;
+    } alloc_site_t;
+
+    typedef struct alloc_stats_s {
+        int enabled;
+        long lines;
+        alloc_count_t total;
+        alloc_count_t line;
+        alloc_site_t sites[ALLOC_SITES];
+        void **set;
+        size_t set_cap;
+        size_t set_nb;
+    } alloc_stats_t;
 
     void my_putchar(char c);
     int my_put_digit(int i);
@@ -45,8 +107,8 @@
     int is_alpha(char c);
     int count_words(char *str, char *separator);
     int is_alphanum(char c);
-    char *my_strdup(char *src);
-    char *my_strndup(char *str, int n);
+    char *my_strdup_at(char *src, char const *file);
+    char *my_strndup_at(char *str, int n, char const *file);
     int is_prime_number(int nb);
     char *my_strcpy(char *src, char *dest);
     int my_strncmp(char const *s1, char const *s2, int n);
@@ -54,13 +116,18 @@
     int my_strstr(char *str, char *to_find);
     int recursive_power(int nb, int p);
     char *reverse_string(char *str);
-    char *str_concat(char *dest, char const *src);
+    char *str_concat_at(char *dest, char const *src, char const *file);
     char *my_strupcase(char *str);
     char *my_strlowcase(char *str);
     char *my_strcapitalize(char *str);
     int show_combinations(int nb);
     int my_isneg (int n);
     int my_put_nbr(int nb);
+    void my_put_nbr_fd(long nb, int fd);
+    unsigned long my_hash(char const *str);
+    unsigned long my_hash_n(char const *str, int len);
+    int my_nbr_to_str(long nb, char *buf);
+    long my_getnbr(char const *str);
     int my_putstr(char const *str);
     int my_str_isnum(char const *str);
     int my_str_iscapalpha(char *str);
@@ -72,10 +139,55 @@
     int my_strspn(char *str, char *accepted_chars);
     int my_strcspn(char *str, char *acptd_chars);
     int palindrome_guesser(char *str);
-    char **my_split(char *str, char *separator);
-    char *str_cleaner(char *str, char separator);
+    charset_t charset_make(char const *chars);
+    charset_t const *charset_class(int cls);
+    int charset_span(charset_t const *set, char const *str);
+    int charset_cspan(charset_t const *set, char const *str);
+    char const *charset_token(charset_t const *seps, char const *str, int *len);
+    char *pack_token(char *dest, char const *src, int len);
+    char **my_split_at(char *str, char *separator, char const *file);
+    void sb_init(strbuf_t *sb);
+    int sb_reserve(strbuf_t *sb, int extra);
+    int sb_append(strbuf_t *sb, char const *str, int len);
+    int sb_append_many(strbuf_t *sb, ...);
+    char *sb_reset(strbuf_t *sb);
+    char *sb_steal(strbuf_t *sb);
+    void sb_free(strbuf_t *sb);
+    int str_norm_span(char const *str, int len, char const *seps);
+    char *str_normalize(char *str, char const *seps);
     int my_array_len(char **array);
     void free_array(char **array);
     void draw_array(char **array);
+    alloc_stats_t *alloc_stats(void);
+    void alloc_stats_init(char **env);
+    int alloc_site(alloc_stats_t *stats, char const *file);
+    void alloc_add(alloc_count_t *count, long size, int sign);
+    void alloc_account(alloc_stats_t *stats, alloc_header_t *header, int sign);
+    size_t alloc_set_slot(alloc_stats_t *stats, void *ptr);
+    int alloc_set_grow(alloc_stats_t *stats);
+    int alloc_set_add(alloc_stats_t *stats, void *ptr);
+    int alloc_set_remove(alloc_stats_t *stats, void *ptr);
+    void *my_malloc(size_t size, char const *file);
+    void *my_calloc(size_t nb, size_t size, char const *file);
+    void *my_realloc(void *ptr, size_t size, char const *file);
+    void *alloc_strip(alloc_stats_t *stats, alloc_header_t *header,
+        size_t size);
+    void my_free(void *ptr, char const *file);
+    void alloc_print_count(alloc_count_t *count, int fd, int peak);
+    void alloc_print_site(alloc_site_t *site, int fd);
+    int alloc_best_site(alloc_stats_t *stats, char *done);
+    void alloc_stats_print(int fd);
+    void alloc_stats_line_start(void);
+    void alloc_stats_line_end(void);
+    #ifndef MY_ALLOC_IMPL
+        #define malloc(size) my_malloc(size, __FILE__)
+        #define calloc(nb, size) my_calloc(nb, size, __FILE__)
+        #define realloc(ptr, size) my_realloc(ptr, size, __FILE__)
+        #define free(ptr) my_free(ptr, __FILE__)
+    #endif
+    #define my_strdup(src) my_strdup_at(src, __FILE__)
+    #define my_strndup(str, n) my_strndup_at(str, n, __FILE__)
+    #define str_concat(dest, src) str_concat_at(dest, src, __FILE__)
+    #define my_split(str, sep) my_split_at(str, sep, __FILE__)
 
 #endif
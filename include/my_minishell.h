@@ -17,24 +17,463 @@
     #include <stdint.h>
     #include <sys/sysmacros.h>
     #include <stdbool.h>
+    #include <sys/inotify.h>
+    #include <termios.h>
+    #include <signal.h>
+    #include "my.h"
+    #define STAT_CACHE_SIZE 64
+    #define STAT_UNKNOWN (-2)
+    #define ACCESS_MODES 8
+
+    typedef struct stat_entry_s {
+        char *path;
+        int stat_ret;
+        struct stat info;
+        int access_ret[ACCESS_MODES];
+    } stat_entry_t;
+
+    typedef struct stat_cache_s {
+        stat_entry_t entries[STAT_CACHE_SIZE];
+        int nb_entries;
+        long lookups;
+        long syscalls;
+    } stat_cache_t;
+
+    #define CMD_CACHE_SIZE 256
+    #define PATH_WATCH_BUFFER 4096
+    #define PATH_WATCH_MASK (IN_CREATE | IN_DELETE | IN_ATTRIB |\
+                            IN_MOVED_FROM | IN_MOVED_TO |\
+                            IN_DELETE_SELF | IN_MOVE_SELF)
+
+    typedef struct cmd_entry_s {
+        char *name;
+        int dir;
+        struct cmd_entry_s *next;
+    } cmd_entry_t;
+
+    typedef struct path_dir_s {
+        char *path;
+        int fd;
+        int wd;
+        struct timespec mtime;
+    } path_dir_t;
+
+    typedef struct cmd_cache_s {
+        cmd_entry_t *buckets[CMD_CACHE_SIZE];
+        path_dir_t *dirs;
+        int nb_dirs;
+        char *path_value;
+        int inotify_fd;
+        unsigned long generation;
+    } cmd_cache_t;
+
+    #define GLOB_DENTS_BUFFER (256 * 1024)
+
+    typedef enum glob_type_e {
+        GLOB_LITERAL,
+        GLOB_ANY,
+        GLOB_STAR,
+        GLOB_CLASS
+    } glob_type_t;
+
+    typedef struct glob_op_s {
+        glob_type_t type;
+        char c;
+        unsigned char set[32];
+    } glob_op_t;
+
+    typedef struct glob_pat_s {
+        glob_op_t *ops;
+        int nb_ops;
+        bool dot_ok;
+    } glob_pat_t;
+
+    typedef struct glob_list_s {
+        char *buf;
+        size_t len;
+        size_t cap;
+        size_t *offs;
+        int nb;
+        int cap_offs;
+    } glob_list_t;
+
+    typedef struct glob_scan_s {
+        char *dir;
+        char *prefix;
+        glob_pat_t *pat;
+        bool want_dir;
+        bool want_exec;
+        glob_list_t *out;
+    } glob_scan_t;
+
+    typedef struct linux_dirent64_s {
+        uint64_t d_ino;
+        int64_t d_off;
+        unsigned short d_reclen;
+        unsigned char d_type;
+        char d_name[];
+    } linux_dirent64_t;
+
+    #define ARENA_BLOCK_SIZE 4096
+    #define VAR_TABLE_SIZE 64
+
+    typedef struct arena_block_s {
+        struct arena_block_s *next;
+        size_t size;
+        size_t used;
+        char data[];
+    } arena_block_t;
+
+    typedef struct arena_map_s {
+        struct arena_map_s *next;
+        char *data;
+        size_t size;
+    } arena_map_t;
+
+    typedef struct arena_s {
+        arena_block_t *head;
+        arena_map_t *maps;
+    } arena_t;
+
+    typedef struct var_entry_s {
+        char *name;
+        char *value;
+        struct var_entry_s *next;
+    } var_entry_t;
+
+    typedef struct var_table_s {
+        var_entry_t *buckets[VAR_TABLE_SIZE];
+        int nb_vars;
+    } var_table_t;
+
+    typedef enum var_kind_e {
+        VAR_PLAIN,
+        VAR_LITERAL,
+        VAR_STATUS,
+        VAR_PID,
+        VAR_COUNT,
+        VAR_DEFINED,
+        VAR_BAD_BRACE
+    } var_kind_t;
+
+    typedef struct var_ref_s {
+        var_kind_t kind;
+        char const *name;
+        int len;
+        int consumed;
+    } var_ref_t;
+
+    #define ALIAS_TABLE_SIZE 64
+    #define ALIAS_MAX_DEPTH 20
+
+    typedef struct alias_entry_s {
+        char *name;
+        char **words;
+        int nb_words;
+        char *text;
+        struct alias_entry_s *next;
+    } alias_entry_t;
+
+    typedef struct alias_table_s {
+        alias_entry_t *buckets[ALIAS_TABLE_SIZE];
+        int nb_aliases;
+    } alias_table_t;
+
+    #define HIST_FILE ".mysh_history"
+    #define HIST_INDEX_SUFFIX ".idx"
+    #define HIST_MAGIC 0x3176696873796d00UL
+    #define HIST_LEVELS 3
+    #define HIST_BUCKETS 16384
+    #define HIST_GROW 4096
+    #define HIST_EVENT_END " \t\n;|&<>()="
+    #define HIST_LINKS(hist) ((hist_link_t *)((hist)->header + 1))
+
+    typedef struct hist_header_s {
+        uint64_t magic;
+        uint64_t count;
+        uint64_t heads[HIST_LEVELS][HIST_BUCKETS];
+    } hist_header_t;
+
+    typedef struct hist_link_s {
+        uint64_t offset;
+        uint64_t length;
+        uint64_t time;
+        uint64_t prev[HIST_LEVELS];
+    } hist_link_t;
+
+    typedef struct history_s {
+        int text_fd;
+        int index_fd;
+        char *text;
+        size_t text_size;
+        hist_header_t *header;
+        size_t index_size;
+        uint64_t *own;
+        int nb_own;
+        int cap_own;
+    } history_t;
+
+    typedef struct hist_out_s {
+        char *buf;
+        int len;
+        int cap;
+        bool changed;
+    } hist_out_t;
+
+    #define PROMPT "[Redshell]$> "
+    #define LE_CONTINUE 0
+    #define LE_DONE 1
+    #define LE_EOF 2
+    #define LE_KEY_CTRL(c) ((c) & 0x1f)
+    #define LE_ESC_TIMEOUT 50
+    #define COMPLETE_DIRS 8
+    #define BUILTIN_NAMES "cd", "exit", "env", "setenv", "unsetenv",\
+                            "set", "unset", "alias", "unalias", "history",\
+                            "memstats", "timeout", "batch"
+
+    typedef struct line_edit_s {
+        char *buf;
+        int len;
+        int cap;
+        int pos;
+        uint64_t hist_idx;
+        char *draft;
+        bool tabbed;
+    } line_edit_t;
+
+    typedef struct dir_cache_s {
+        dev_t dev;
+        ino_t ino;
+        struct timespec mtime;
+        glob_list_t list;
+        char **names;
+        int nb_names;
+    } dir_cache_t;
+
+    typedef struct completion_s {
+        glob_list_t list;
+        char **commands;
+        int nb_commands;
+        unsigned long generation;
+        bool built;
+        dir_cache_t dirs[COMPLETE_DIRS];
+        int next_dir;
+    } completion_t;
+
+    typedef struct complete_match_s {
+        char **names;
+        int first;
+        int nb;
+        char *dir;
+        int typed;
+    } complete_match_t;
+
+    #define SIGNAL_MESSAGES {SIGHUP, "Hangup"}, {SIGQUIT, "Quit"},\
+                        {SIGILL, "Illegal instruction"},\
+                        {SIGTRAP, "Trace/BPT trap"}, {SIGABRT, "Abort"},\
+                        {SIGBUS, "Bus error"},\
+                        {SIGFPE, "Floating exception"},\
+                        {SIGKILL, "Killed"}, {SIGUSR1, "User signal 1"},\
+                        {SIGSEGV, "Segmentation fault"},\
+                        {SIGUSR2, "User signal 2"},\
+                        {SIGPIPE, "Broken pipe"}, {SIGALRM, "Alarm clock"},\
+                        {SIGTERM, "Terminated"},\
+                        {SIGXCPU, "Cputime limit exceeded"},\
+                        {SIGXFSZ, "Filesize limit exceeded"},\
+                        {SIGSYS, "Bad system call"}
+
+    typedef struct signal_msg_s {
+        int sig;
+        char const *message;
+    } signal_msg_t;
+
+    typedef struct group_scan_s {
+        bool command;
+        bool target;
+    } group_scan_t;
+
+    typedef struct group_s {
+        char *body;
+        char *file;
+        bool append;
+        char *in;
+        bool here;
+        int in_fd;
+    } group_t;
+
+    #define PIPE_NOCATOPT "nocatopt"
+    #define PIPE_SIZE_VAR "pipesize"
+    #define PIPE_SIZE_MIN (64 * 1024)
+    #define PIPE_SIZE_MAX_FILE "/proc/sys/fs/pipe-max-size"
+
+    typedef struct command_s {
+        char **argv;
+        char *in;
+        char *out;
+        bool append;
+        int in_fd;
+        int out_fd;
+        bool here;
+        char *group;
+    } command_t;
+
+    typedef struct pipeline_s {
+        command_t *cmds;
+        int nb;
+    } pipeline_t;
+
+    #define SUBST_PIPE_SIZE (1024 * 1024)
+    #define SUBST_BUFFER_SIZE (64 * 1024)
+    #define SUBST_IFS " \t\n"
+
+    typedef struct subst_out_s {
+        char *data;
+        size_t len;
+    } subst_out_t;
+
+    typedef struct word_vec_s {
+        char **words;
+        int nb;
+        int cap;
+    } word_vec_t;
+
+    typedef struct subst_pend_s {
+        char *str;
+        int len;
+    } subst_pend_t;
+
+    typedef struct subst_ctx_s {
+        word_vec_t vec;
+        subst_pend_t pend;
+    } subst_ctx_t;
+
+    #define ENV_INDEX_MIN 64
+
+    typedef struct env_index_s {
+        int *slots;
+        int cap;
+        int nb;
+        bool valid;
+    } env_index_t;
+
+    typedef struct env_view_s {
+        char *value;
+        int len;
+    } env_view_t;
+
+    #define LOOP_EVENTS 16
+    #define LOOP_STDIN 1
+    #define LOOP_INTERRUPT 2
+    #define LOOP_RESIZE 4
+    #define READER_CHUNK 4096
+    #define TIMEOUT_STATUS 124
+    #define TIMEOUT_GRACE 2000
+    #define TIMEOUT_MAX 1000000000000L
+    #define BATCH_STATUS 123
+    #define BATCH_HEADROOM 2048
+    #define BATCH_READ (128 * 1024)
+    #define BATCH_JOBS_MAX 256
+
+    typedef struct child_s {
+        pid_t pid;
+        int pidfd;
+        int status;
+        bool done;
+        bool detached;
+        struct child_s *next;
+    } child_t;
+
+    typedef struct deadline_s {
+        long at;
+        long grace;
+        int signals;
+    } deadline_t;
+
+    typedef struct batch_s {
+        char **cmd;
+        int nb_cmd;
+        long budget;
+        long used;
+        int max_items;
+        glob_list_t items;
+        char **argv;
+        int cap_argv;
+        pid_t *pids;
+        int jobs;
+        int running;
+        bool from_stdin;
+        bool failed;
+    } batch_t;
+
+    typedef struct line_reader_s {
+        char *buf;
+        int start;
+        int end;
+        int cap;
+        bool eof;
+    } line_reader_t;
+
+    typedef struct event_loop_s {
+        int epoll_fd;
+        int signal_fd;
+        sigset_t saved_mask;
+        child_t *children;
+        bool interactive;
+        bool stdin_added;
+        bool stdin_plain;
+        bool interrupted;
+        bool resized;
+        deadline_t deadline;
+        line_reader_t reader;
+    } event_loop_t;
 
     typedef struct env_s {
         char **env_copy;
+        env_index_t env_index;
         char *old_pwd;
         char *pwd;
+        stat_cache_t *stat_cache;
+        cmd_cache_t *cmd_cache;
+        var_table_t *shell_vars;
+        alias_table_t *aliases;
+        history_t *history;
+        arena_t *line_arena;
+        completion_t *completion;
+        int last_status;
+        bool is_child;
+        char *env_lo;
+        char *env_hi;
+        long cat_elided;
+        event_loop_t *loop;
+        char **exec_env;
     } env_t;
 
-    char *my_getenv(char *name, env_t *env_cpy);
+    int env_scan(env_t *env_cpy, char const *name, int len);
+    int env_find(env_t *env_cpy, char const *name, int len);
+    int env_index_probe(env_t *env_cpy, char const *name, int len);
+    void env_index_add(env_t *env_cpy, int slot);
+    bool env_index_build(env_t *env_cpy);
+    void env_index_append(env_t *env_cpy, int slot);
+    void env_index_drop(env_t *env_cpy);
+    env_view_t env_view(env_t *env_cpy, char const *name);
     bool check_nmrs_gtl(char *buffer);
     int my_getenv_index(char *name, env_t *env_cpy);
     int count_nb_lines_array(char **array);
     int nb_occ_strstr(char *str, char *to_find);
-    int is_it_file(char *path, struct stat statbuffer);
-    int is_it_dir(char *path, struct stat statbuffer);
+    int is_it_file(env_t *env_cpy, char *path);
+    int is_it_dir(env_t *env_cpy, char *path);
     int nb_len_array(char **array);
     int my_cd(char **input, env_t *env_cpy);
     bool check_key_existence(char *name_value, env_t *env_cpy);
-    int my_env(env_t *env_cpy);
+    void env_print(char **envp);
+    int env_options(char **input, char **edits, int *nb, bool *clear);
+    void env_run(env_t *env_cpy, char **input);
+    int my_env(char **input, env_t *env_cpy);
+    char **exec_envp(env_t *env_cpy);
+    int env_assign_count(char **input);
+    int env_overlay_edit(char **envp, int len, char *edit);
+    char **env_overlay(env_t *env_cpy, char **edits, int nb, bool clear);
+    void run_argv(char **input, env_t *env_cpy, bool forkable);
     char **replace_key(env_t *env_cpy, char *key, char **input);
     char **create_new_key(env_t *env_cpy, char *new_key);
     char **delete_key(env_t *env_cpy, char *key);
@@ -44,10 +483,9 @@
     int my_unsetenv(env_t *env_cpy, char **input);
     int all_bins_function(char *indication, char **input,
         env_t *env_cpy, bool forkable);
-    char *create_path_ez(char *current_dir, char *order);
-    char *create_path_i(char *current_dir, char **input, int i);
+    char *create_path_ez(strbuf_t *sb, char *current_dir, char *order);
+    char *create_path_i(strbuf_t *sb, char *current_dir, char **input, int i);
     void my_putstr_err(char *message);
-    void execute_order(char *path, char **input, char **env);
     char **my_strcpy_array(char **array_copy, char **array);
     char **my_strdup_array(char **array, char **array_copy);
     char **my_strdup_array_keyless(env_t *env_cpy, char **arr_cpy, char *key);
@@ -57,7 +495,6 @@
     bool check_diff_seps(char *str, char separator);
     bool check_recs_existencies(char *str, char separator);
     char *delete_sep_recurencies(char *str, char separators);
-    char *turn_sep_to_spaces(char *str, char separator);
     char *rm_last_gtl(char *str);
     char *rm_trailling_spaces(char *str);
     bool last_char_str(char *str, char elem);
@@ -74,24 +511,307 @@
     int getenv_name_len(char *whole_key);
     char *cd_alone(char **input, env_t *env_cpy, char *path);
     int cd_only(char **input, env_t *env_cpy, char *current_dir);
-    int cd_on_folder(char **input, env_t *env_cpy,
-                    char *current_dir, struct stat statbuffer);
-    int cd_another(char *path, env_t *env_cpy,
-                char *current_dir, struct stat statbuffer);
+    int cd_on_folder(char **input, env_t *env_cpy, char *current_dir);
+    int cd_another(char *path, env_t *env_cpy, char *current_dir);
     int cd_minus(char **input, env_t *env_cpy, char *current_dir);
     char **append_to_array(char **array, char *str);
     char **my_split_coma(char *str, char separator);
     char **my_split_pipe(char *str, char separator);
     char **get_array_inputs_coma(char *buffer);
-    char **get_array_inputs_pipe(char *buffer);
     char **get_array_inputs_redirect(char *buffer);
     int db_redirect_in_str(char *str);
     void parse_on_pipe(char **array_coma, env_t *env_cpy);
-    int my_pipe(char *order_one, char *order_two, env_t *env_cpy);
     int my_double_redirect(char *order_one, char *order_two, env_t *env_cpy,
                 int zero_empty);
     int my_redirect(char *order_one, char *order_two, env_t *env_cpy,
                 int zero_empty);
     char **append_arr_to_arr(char **arr_dest, char **arr_src);
+    stat_cache_t *stat_cache_new(void);
+    void stat_cache_flush(stat_cache_t *cache);
+    stat_entry_t *stat_cache_entry(stat_cache_t *cache, char *path);
+    int cached_stat(env_t *env_cpy, char *path, struct stat *buf);
+    int cached_access(env_t *env_cpy, char *path, int mode);
+    cmd_cache_t *cmd_cache_new(void);
+    cmd_entry_t *cmd_cache_find(cmd_cache_t *cache, char *name);
+    cmd_entry_t *cmd_cache_add(cmd_cache_t *cache, char *name, int dir);
+    void cmd_cache_drop_name(cmd_cache_t *cache, char *name);
+    void drop_bucket_from(cmd_entry_t **link, int dir);
+    void cmd_cache_drop_from(cmd_cache_t *cache, int dir);
+    void cmd_cache_sync(env_t *env_cpy);
+    int cmd_resolve(env_t *env_cpy, char *name);
+    int cmd_locate(env_t *env_cpy, char *name);
+    void path_dir_open(path_dir_t *dir);
+    bool path_dir_has(env_t *env_cpy, path_dir_t *dir, char *name);
+    void path_dirs_free(cmd_cache_t *cache);
+    void path_dir_exec(env_t *env_cpy, path_dir_t *dir, char *name,
+        char **input);
+    void mysh_exec(env_t *env_cpy, char *path, char **input);
+    void path_watch_add(cmd_cache_t *cache, path_dir_t *dir);
+    void path_dirs_build(cmd_cache_t *cache, char *path_value);
+    void path_watch_event(cmd_cache_t *cache, struct inotify_event *event);
+    void path_watch_drain(cmd_cache_t *cache);
+    void path_dirs_poll(cmd_cache_t *cache);
+    bool path_wd_shared(cmd_cache_t *cache, int index);
+    void path_dirs_chdir(cmd_cache_t *cache);
+    void cwd_changed(env_t *env_cpy);
+    int glob_class_range(glob_op_t *op, char const *pat);
+    int glob_compile_class(glob_op_t *op, char const *pat);
+    int glob_compile_op(glob_op_t *op, char const *pat);
+    glob_pat_t *glob_compile(char const *pat, int len);
+    void glob_free(glob_pat_t *compiled);
+    bool glob_op_match(glob_op_t *op, unsigned char c);
+    bool glob_match(glob_pat_t *pat, char const *str);
+    bool glob_has_magic(char const *word);
+    bool glob_any_magic(char **input);
+    bool glob_list_reserve(glob_list_t *list, size_t len);
+    bool glob_list_push(glob_list_t *list, char const *prefix,
+        char const *name, size_t name_len);
+    char **glob_list_strings(glob_list_t *list);
+    void glob_list_free(glob_list_t *list);
+    void glob_sort(char **strs, int nb, int depth);
+    void glob_swap(char **strs, int a, int b);
+    void glob_insertion_sort(char **strs, int nb, int depth);
+    void glob_partition(char **strs, int *bounds, int nb, int depth);
+    bool glob_is_dir(int fd, linux_dirent64_t *entry);
+    bool glob_is_exec(int fd, linux_dirent64_t *entry);
+    bool glob_keep(glob_scan_t *scan, int fd, linux_dirent64_t *entry);
+    int glob_scan_chunk(glob_scan_t *scan, int fd, char *buffer, long len);
+    int glob_scan_dir(glob_scan_t *scan);
+    void glob_walk(char *prefix, char **comps, glob_list_t *out);
+    char **glob_word(char *word);
+    char **glob_join(char **input, char ***matches, int total);
+    char **glob_inputs(char **input);
+    void glob_unescape(char *word);
+    char **glob_unescape_words(char **input);
+    char **glob_dir_comps(char const *word, char **comps);
+    char **build_argv(char *command, env_t *env_cpy);
+    arena_t *arena_new(void);
+    arena_block_t *arena_block_new(arena_t *arena, size_t size);
+    void *arena_alloc(arena_t *arena, size_t size);
+    void arena_reset(arena_t *arena);
+    char *arena_strndup(arena_t *arena, char const *str, int len);
+    var_table_t *var_table_new(void);
+    var_entry_t *var_find(var_table_t *table, char const *name, int len);
+    char *var_get(var_table_t *table, char const *name, int len);
+    void var_set(var_table_t *table, char *name, char *value);
+    void var_unset(var_table_t *table, char *name);
+    int var_name_len(char const *str);
+    void var_ref_braced(char const *str, var_ref_t *ref);
+    int var_ref_special(char const *str, var_ref_t *ref);
+    void var_ref_parse(char const *str, var_ref_t *ref);
+    char *var_lookup(env_t *env_cpy, char const *name, int len);
+    int var_undefined(var_ref_t *ref, char *out);
+    bool var_is_status(var_ref_t *ref, env_t *env_cpy);
+    int var_ref_expand(var_ref_t *ref, env_t *env_cpy, char *out);
+    int expand_word(char const *word, env_t *env_cpy, char *out);
+    char **expand_vars(char **input, env_t *env_cpy);
+    void my_set_list(env_t *env_cpy);
+    int my_set_assign(env_t *env_cpy, char *name, char *value);
+    int my_set_word(env_t *env_cpy, char **input, int *i);
+    int my_set(char **input, env_t *env_cpy);
+    int my_unset(char **input, env_t *env_cpy);
+    int part_three_builtin(char **input, env_t *env_cpy);
+    int my_memstats(char **input, env_t *env_cpy);
+    alias_table_t *alias_table_new(void);
+    alias_entry_t *alias_find(alias_table_t *table, char const *name);
+    void alias_entry_clear(alias_entry_t *entry);
+    void alias_set(alias_table_t *table, char *name, char **words);
+    void alias_unset(alias_table_t *table, char *name);
+    char **alias_splice(env_t *env_cpy, alias_entry_t *entry, char **input);
+    bool alias_seen(alias_entry_t **seen, int depth, alias_entry_t *entry);
+    char **expand_alias(char **input, env_t *env_cpy);
+    void my_alias_list(env_t *env_cpy);
+    bool alias_too_dangerous(char *builtin, char *name);
+    int my_alias(char **input, env_t *env_cpy);
+    int my_unalias(char **input, env_t *env_cpy);
+    env_t *init_env(char **env);
+    void env_borrow(env_t *env_cpy, char **env);
+    char **env_share(char **array, int nb, int extra);
+    void env_entry_free(env_t *env_cpy, char *entry);
+    void env_entry_set(env_t *env_cpy, int index, char *entry);
+    void env_append(env_t *env_cpy, char *entry);
+    bool hist_map_index(history_t *hist, size_t size);
+    bool hist_reserve(history_t *hist, uint64_t nb_links);
+    bool hist_map_text(history_t *hist, size_t end);
+    char *hist_path(env_t *env_cpy, char *suffix);
+    history_t *hist_open(env_t *env_cpy);
+    bool hist_check_magic(history_t *hist);
+    uint64_t *hist_head(history_t *hist, char const *line, int level);
+    void hist_chain(history_t *hist, uint64_t idx, char const *line, int len);
+    bool hist_write_text(history_t *hist, char const *line, int len,
+        uint64_t *offset);
+    void hist_own_push(history_t *hist, uint64_t idx);
+    void hist_add(history_t *hist, char const *line, int len);
+    uint64_t hist_count(history_t *hist);
+    char *hist_text(history_t *hist, uint64_t idx, int *len);
+    bool hist_match(char const *text, int len, char const *prefix, int plen);
+    int64_t hist_find_prefix(history_t *hist, char const *prefix, int plen);
+    int64_t hist_own(history_t *hist, long nb);
+    bool hist_append(hist_out_t *out, char const *str, int len);
+    int hist_event_len(char const *spec);
+    int64_t hist_event(history_t *hist, char const *spec, int len);
+    int hist_substitute(history_t *hist, char const *spec, hist_out_t *out);
+    char *hist_expand(env_t *env_cpy, char *line);
+    int hist_put_clock(char *buf, time_t when);
+    void hist_print_entry(history_t *hist, uint64_t idx);
+    int my_history(char **input, env_t *env_cpy);
+    void print_shell_stats(env_t *env_cpy);
+    void mysh_exit(env_t *env_cpy, int status);
+    pid_t mysh_fork(env_t *env_cpy);
+    bool loop_open(event_loop_t *loop);
+    event_loop_t *loop_new(void);
+    void loop_child_reset(event_loop_t *loop);
+    void loop_restore_mask(event_loop_t *loop);
+    void loop_signal(env_t *env_cpy);
+    int loop_wait(env_t *env_cpy, int timeout);
+    bool loop_arm_stdin(event_loop_t *loop);
+    int loop_wait_stdin(env_t *env_cpy);
+    void child_track(event_loop_t *loop, pid_t pid);
+    child_t *child_find(event_loop_t *loop, pid_t pid, int pidfd);
+    int child_status(siginfo_t *info);
+    void child_reap(event_loop_t *loop, child_t *child);
+    void child_forget(event_loop_t *loop, child_t *child);
+    bool child_stopped(child_t *child, int options);
+    pid_t mysh_waitpid(env_t *env_cpy, pid_t pid, int *status, int options);
+    long deadline_now(void);
+    void deadline_arm(deadline_t *deadline, long limit, long grace);
+    int deadline_timeout(deadline_t *deadline);
+    void deadline_check(deadline_t *deadline, child_t *child);
+    long timeout_unit(char const *suffix);
+    long timeout_parse(char const *str);
+    int timeout_usage(char **input, int arg, long grace);
+    int my_timeout(char **input, env_t *env_cpy);
+    long batch_budget(env_t *env_cpy, char **cmd);
+    char **batch_argv(batch_t *batch);
+    void batch_reset(batch_t *batch);
+    int batch_add(env_t *env_cpy, batch_t *batch, char const *item,
+        size_t len);
+    void batch_child(env_t *env_cpy, batch_t *batch, char **argv);
+    void batch_collect(env_t *env_cpy, batch_t *batch, int slot);
+    int batch_done(event_loop_t *loop, batch_t *batch);
+    void batch_reap(env_t *env_cpy, batch_t *batch);
+    int batch_flush(env_t *env_cpy, batch_t *batch);
+    int batch_number(char const *str);
+    int batch_skip_words(char **input, int arg);
+    long batch_lines(env_t *env_cpy, batch_t *batch, char *buf, size_t len);
+    int batch_read(env_t *env_cpy, batch_t *batch);
+    int batch_words(env_t *env_cpy, batch_t *batch, char **words);
+    int batch_options(char **input, batch_t *batch, char ***words);
+    bool batch_open(env_t *env_cpy, batch_t *batch, char **cmd);
+    void batch_close(batch_t *batch);
+    int my_batch(char **input, env_t *env_cpy);
+    char *reader_take(line_reader_t *reader, int len);
+    bool reader_room(line_reader_t *reader);
+    void reader_fill(env_t *env_cpy);
+    char *reader_line(env_t *env_cpy);
+    bool le_raw_mode(struct termios *saved);
+    void le_redraw(line_edit_t *le);
+    char *line_edit(env_t *env_cpy);
+    char *read_line(env_t *env_cpy);
+    bool le_reserve(line_edit_t *le, int extra);
+    void le_insert(line_edit_t *le, char const *str, int len);
+    void le_delete(line_edit_t *le, int at, int len);
+    void le_set_line(line_edit_t *le, char const *str, int len);
+    void le_history(env_t *env_cpy, line_edit_t *le, int dir);
+    int le_read_timed(char *buf, int len);
+    void le_escape(env_t *env_cpy, line_edit_t *le);
+    int le_motion(line_edit_t *le, unsigned char c);
+    int le_control(env_t *env_cpy, line_edit_t *le, unsigned char c);
+    int le_next_key(env_t *env_cpy, line_edit_t *le, unsigned char *c);
+    int le_key(env_t *env_cpy, line_edit_t *le);
+    completion_t *complete_new(void);
+    void complete_index_reset(completion_t *comp);
+    void complete_index_build(env_t *env_cpy, completion_t *comp);
+    void complete_commands(env_t *env_cpy, char const *word,
+        complete_match_t *match);
+    int complete_range(char **names, int nb, char const *prefix, int *first);
+    int complete_common(complete_match_t *match);
+    void complete_put_cell(char const *name, int width, bool last);
+    void complete_print(complete_match_t *match);
+    int complete_compact(char **names, int nb);
+    bool complete_dir_load(dir_cache_t *cache, char *dir, struct stat *info);
+    dir_cache_t *complete_dir(completion_t *comp, char *dir);
+    void complete_files(env_t *env_cpy, char const *word,
+        complete_match_t *match);
+    int le_word_start(line_edit_t *le);
+    bool le_command_word(line_edit_t *le, int start);
+    void complete_insert(line_edit_t *le, complete_match_t *match);
+    void le_complete(env_t *env_cpy, line_edit_t *le);
+    int builtin_status(env_t *env_cpy, int ret);
+    char const *signal_message(int sig);
+    void wait_status(env_t *env_cpy, int status);
+    void exec_failed(env_t *env_cpy, char *name);
+    int my_exit(char **input, env_t *env_cpy);
+    int logic_next_op(char const *str);
+    bool logic_is_blank(char const *str, int len);
+    bool logic_valid(char const *segment);
+    void run_logic_list(char *segment, env_t *env_cpy);
+    void simple_redirection(char *command, env_t *env_cpy);
+    void double_redirection(char *command, env_t *env_cpy);
+    void simple_command(char *command, env_t *env_cpy);
+    void core_executor(char *command, env_t *env_cpy);
+    int group_close(char const *str, int i);
+    bool group_balanced(char const *line);
+    int top_level_next(char const *str, charset_t const *seps);
+    char **split_top_level(char *str, char const *seps);
+    void parse_line(char *line, env_t *env_cpy);
+    bool group_word_safe(env_t *env_cpy, char const *word, int len);
+    bool group_word_check(env_t *env_cpy, char const *word, int len,
+        group_scan_t *scan);
+    bool group_forkless(env_t *env_cpy, char const *body);
+    int group_redirect_word(char *tail, group_t *group);
+    int group_tail(char *tail, group_t *group);
+    int here_doc_open(env_t *env_cpy, char const *word);
+    int group_parse(env_t *env_cpy, char *command, group_t *group);
+    void group_free(group_t *group);
+    int group_redirect(group_t *group, int *saved);
+    int group_input(group_t *group, int *saved);
+    void group_restore(int saved, int fd);
+    void group_run(env_t *env_cpy, group_t *group, bool forked);
+    void run_group(char *command, env_t *env_cpy);
+    char *redirect_word(char *text, int at);
+    int command_redirect(char *text, command_t *cmd);
+    int command_group(char *stage, command_t *cmd, env_t *env_cpy);
+    int command_parse(char *stage, command_t *cmd, env_t *env_cpy);
+    int pipeline_count(char *line);
+    int pipeline_parse(char *line, pipeline_t *pl, env_t *env_cpy);
+    int pipeline_check(pipeline_t *pl);
+    bool pipeline_cat_shape(command_t *cat, command_t *next);
+    int pipeline_cat_fd(env_t *env_cpy, command_t *cat, command_t *next);
+    void pipeline_elide_cat(env_t *env_cpy, pipeline_t *pl);
+    void pipeline_free(pipeline_t *pl);
+    long pipe_size_max(void);
+    long pipe_size_parse(char const *value);
+    long pipe_size_get(env_t *env_cpy);
+    void pipe_size_apply(int *fd, long size);
+    int redirect_error(char *file);
+    int command_open(command_t *cmd);
+    void stage_child(env_t *env_cpy, command_t *cmd, int in, int *fd);
+    void pipeline_spawn(env_t *env_cpy, pipeline_t *pl, pid_t *pids);
+    void pipeline_wait(env_t *env_cpy, pipeline_t *pl, pid_t *pids);
+    bool pipeline_inline(command_t *cmd);
+    pid_t stage_spawn(env_t *env_cpy, command_t *cmd, int in, int *fd);
+    void pipeline_run_inline(env_t *env_cpy, pipeline_t *pl);
+    void command_run_here(env_t *env_cpy, command_t *cmd);
+    void run_pipeline(char *command, env_t *env_cpy);
+    arena_map_t *arena_map_new(arena_t *arena, size_t size);
+    bool arena_map_grow(arena_map_t *map, size_t size);
+    void arena_map_release(arena_t *arena);
+    int subst_end(char const *str, int i);
+    int subst_next(char const *str, int i);
+    int top_level_find(char const *str, char const *set);
+    bool subst_any(char **input);
+    void subst_child(env_t *env_cpy, char const *body, int len, int *fd);
+    int subst_read(arena_t *arena, int fd, subst_out_t *out);
+    int subst_capture(env_t *env_cpy, char const *body, int len,
+        subst_out_t *out);
+    bool word_vec_push(word_vec_t *vec, char *word);
+    bool subst_join(arena_t *arena, subst_pend_t *pend, char *str, int len);
+    char *subst_field(char **cursor, int *len);
+    int subst_fields(env_t *env_cpy, char const *body, int len,
+        subst_ctx_t *ctx);
+    int subst_literal(env_t *env_cpy, char *word, int i, subst_ctx_t *ctx);
+    int subst_word(env_t *env_cpy, char *word, subst_ctx_t *ctx);
+    char **subst_inputs(char **input, env_t *env_cpy);
 
 #endif
@@ -0,0 +1,69 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** charset
+*/
+
+#include <string.h>
+#include "my.h"
+
+charset_t charset_make(char const *chars)
+{
+    charset_t set;
+    unsigned char c = 0;
+
+    memset(&set, 0, sizeof(charset_t));
+    for (int i = 0; chars[i] != '\0'; i++) {
+        c = chars[i];
+        set.bits[c >> 6] |= (uint64_t)1 << (c & 63);
+    }
+    return set;
+}
+
+/*
+** Built on first use from the alphabets in my.h, so every classification
+** after that is a single bit test.
+*/
+charset_t const *charset_class(int cls)
+{
+    static charset_t classes[CHARSET_CLASSES];
+    static int ready = 0;
+
+    if (!ready) {
+        classes[CHARSET_ALPHA] = charset_make(ALPHABET);
+        classes[CHARSET_DIGIT] = charset_make(DIGITS);
+        classes[CHARSET_ALNUM] = charset_make(ALPHABET DIGITS);
+        classes[CHARSET_NAME] = charset_make(ALPHABET DIGITS "_");
+        classes[CHARSET_FILE] = charset_make(ALPHABET EXT_ALPHABET);
+        ready = 1;
+    }
+    return &classes[cls];
+}
+
+int charset_span(charset_t const *set, char const *str)
+{
+    int i = 0;
+
+    while (CHARSET_HAS(set, str[i]))
+        i++;
+    return i;
+}
+
+int charset_cspan(charset_t const *set, char const *str)
+{
+    int i = 0;
+
+    while (str[i] != '\0' && !CHARSET_HAS(set, str[i]))
+        i++;
+    return i;
+}
+
+char const *charset_token(charset_t const *seps, char const *str, int *len)
+{
+    str += charset_span(seps, str);
+    if (*str == '\0')
+        return NULL;
+    *len = charset_cspan(seps, str);
+    return str;
+}
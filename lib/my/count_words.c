@@ -6,27 +6,21 @@
 */
 
 #include <unistd.h>
-#include <stdbool.h>
 #include "my.h"
 
 int count_words(char *str, char *separator)
 {
-    int i = 0;
+    charset_t seps;
+    char const *word = str;
+    int len = 0;
     int count = 0;
-    bool sep_requiem = true;
 
     if (str == NULL)
         return 0;
-    while (str[i] != '\0') {
-        if (my_strchr(separator, str[i]) != NULL) {
-            i++;
-            count += !sep_requiem;
-            sep_requiem = true;
-        } else {
-            i++;
-            sep_requiem = false;
-        }
+    seps = charset_make(separator);
+    while ((word = charset_token(&seps, word, &len)) != NULL) {
+        count++;
+        word += len;
     }
-    count += !sep_requiem;
     return count;
 }
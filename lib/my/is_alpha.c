@@ -9,7 +9,5 @@
 
 int is_alpha(char c)
 {
-    if ((c >= 'A' && c <= 'Z' ) || (c >= 'a' && c <= 'z'))
-        return 0;
-    return 1;
+    return !CHARSET_HAS(charset_class(CHARSET_ALPHA), c);
 }
@@ -9,9 +9,5 @@
 
 int is_alphanum(char c)
 {
-    if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')
-        || (c >= 'A' && c <= 'Z')) {
-        return (0);
-    }
-    return (1);
+    return !CHARSET_HAS(charset_class(CHARSET_ALNUM), c);
 }
@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_alloc
+*/
+
+#define MY_ALLOC_IMPL
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+
+void *my_malloc(size_t size, char const *file)
+{
+    alloc_stats_t *stats = alloc_stats();
+    alloc_header_t *header = NULL;
+
+    if (!stats->enabled)
+        return malloc(size);
+    header = malloc(sizeof(alloc_header_t) + size);
+    if (header == NULL)
+        return NULL;
+    if (!alloc_set_add(stats, header + 1)) {
+        free(header);
+        return malloc(size);
+    }
+    header->size = size;
+    header->site = alloc_site(stats, file);
+    alloc_account(stats, header, 1);
+    return header + 1;
+}
+
+void *my_calloc(size_t nb, size_t size, char const *file)
+{
+    void *ptr = NULL;
+
+    if (size != 0 && nb > (size_t)-1 / size)
+        return NULL;
+    ptr = my_malloc(nb * size, file);
+    if (ptr != NULL)
+        memset(ptr, 0, nb * size);
+    return ptr;
+}
+
+void *my_realloc(void *ptr, size_t size, char const *file)
+{
+    alloc_stats_t *stats = alloc_stats();
+    alloc_header_t *moved = NULL;
+
+    if (ptr == NULL)
+        return my_malloc(size, file);
+    if (!stats->enabled || !alloc_set_remove(stats, ptr))
+        return realloc(ptr, size);
+    moved = realloc((alloc_header_t *)ptr - 1, sizeof(alloc_header_t) + size);
+    if (moved == NULL) {
+        alloc_set_add(stats, ptr);
+        return NULL;
+    }
+    if (!alloc_set_add(stats, moved + 1))
+        return alloc_strip(stats, moved, size);
+    alloc_account(stats, moved, -1);
+    moved->size = size;
+    moved->site = alloc_site(stats, file);
+    alloc_account(stats, moved, 1);
+    return moved + 1;
+}
+
+/*
+** A block the set has no room for loses its header and becomes a plain
+** libc block again, which my_free then releases untouched.
+*/
+void *alloc_strip(alloc_stats_t *stats, alloc_header_t *header, size_t size)
+{
+    alloc_account(stats, header, -1);
+    memmove(header, header + 1, size);
+    return header;
+}
+
+/*
+** Only pointers in the set were handed out with a header. Anything else
+** comes from libc itself (getcwd, getline, strdup) or from before
+** accounting started, and is released untouched.
+*/
+void my_free(void *ptr, char const *file)
+{
+    alloc_stats_t *stats = alloc_stats();
+    alloc_header_t *header = NULL;
+
+    (void)file;
+    if (ptr == NULL)
+        return;
+    if (!stats->enabled || !alloc_set_remove(stats, ptr)) {
+        free(ptr);
+        return;
+    }
+    header = (alloc_header_t *)ptr - 1;
+    alloc_account(stats, header, -1);
+    free(header);
+}
@@ -0,0 +1,36 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_alloc_line
+*/
+
+#include <string.h>
+#include <unistd.h>
+#include "my.h"
+
+void alloc_stats_line_start(void)
+{
+    alloc_stats_t *stats = alloc_stats();
+
+    memset(&stats->line, 0, sizeof(alloc_count_t));
+    stats->line.live = stats->total.live;
+    stats->line.peak = stats->total.live;
+}
+
+/*
+** live and peak are absolute heap figures, so a line that leaks shows up
+** as a live count that keeps climbing from one line to the next.
+*/
+void alloc_stats_line_end(void)
+{
+    alloc_stats_t *stats = alloc_stats();
+
+    if (!stats->enabled)
+        return;
+    stats->lines++;
+    write(2, "alloc line ", 11);
+    my_put_nbr_fd(stats->lines, 2);
+    write(2, ": ", 2);
+    alloc_print_count(&stats->line, 2, 1);
+}
@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_alloc_print
+*/
+
+#include <string.h>
+#include <unistd.h>
+#include "my.h"
+
+void alloc_print_count(alloc_count_t *count, int fd, int peak)
+{
+    my_put_nbr_fd(count->allocs, fd);
+    write(fd, " mallocs, ", 10);
+    my_put_nbr_fd(count->frees, fd);
+    write(fd, " frees, ", 8);
+    my_put_nbr_fd(count->bytes, fd);
+    write(fd, " bytes, ", 8);
+    my_put_nbr_fd(count->live, fd);
+    write(fd, " live", 5);
+    if (peak) {
+        write(fd, ", ", 2);
+        my_put_nbr_fd(count->peak, fd);
+        write(fd, " peak", 5);
+    }
+    write(fd, "\n", 1);
+}
+
+void alloc_print_site(alloc_site_t *site, int fd)
+{
+    char const *name = strrchr(site->file, '/');
+    int len = 0;
+
+    name = (name == NULL) ? site->file : name + 1;
+    len = my_strlen(name);
+    if (len > 2 && my_strcmp(name + len - 2, ".c") == 0)
+        len -= 2;
+    write(fd, "  ", 2);
+    write(fd, name, len);
+    write(fd, ": ", 2);
+    alloc_print_count(&site->count, fd, 0);
+}
+
+int alloc_best_site(alloc_stats_t *stats, char *done)
+{
+    int best = -1;
+
+    for (int i = 0; i < ALLOC_SITES; i++) {
+        if (done[i] || stats->sites[i].file == NULL)
+            continue;
+        if (best == -1 ||
+            stats->sites[i].count.bytes > stats->sites[best].count.bytes)
+            best = i;
+    }
+    return best;
+}
+
+void alloc_stats_print(int fd)
+{
+    alloc_stats_t *stats = alloc_stats();
+    char done[ALLOC_SITES] = {0};
+    int best = alloc_best_site(stats, done);
+
+    write(fd, "alloc total: ", 13);
+    alloc_print_count(&stats->total, fd, 1);
+    while (best != -1) {
+        done[best] = 1;
+        alloc_print_site(&stats->sites[best], fd);
+        best = alloc_best_site(stats, done);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_alloc_set
+*/
+
+#define MY_ALLOC_IMPL
+#include <stdint.h>
+#include <stdlib.h>
+#include "my.h"
+
+/*
+** Slot holding ptr, or the empty slot where it would go. The table is
+** never more than half full, so there always is one.
+*/
+size_t alloc_set_slot(alloc_stats_t *stats, void *ptr)
+{
+    size_t mask = stats->set_cap - 1;
+    size_t slot = (((uintptr_t)ptr >> 4) * ALLOC_SET_MIX) & mask;
+
+    while (stats->set[slot] != NULL && stats->set[slot] != ptr)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+int alloc_set_grow(alloc_stats_t *stats)
+{
+    void **old = stats->set;
+    size_t old_cap = stats->set_cap;
+
+    stats->set_cap = (old_cap == 0) ? ALLOC_SET_MIN : old_cap * 2;
+    stats->set = calloc(stats->set_cap, sizeof(void *));
+    if (stats->set == NULL) {
+        stats->set = old;
+        stats->set_cap = old_cap;
+        return 0;
+    }
+    for (size_t i = 0; i < old_cap; i++)
+        if (old[i] != NULL)
+            stats->set[alloc_set_slot(stats, old[i])] = old[i];
+    free(old);
+    return 1;
+}
+
+int alloc_set_add(alloc_stats_t *stats, void *ptr)
+{
+    if ((stats->set_nb + 1) * 2 > stats->set_cap && !alloc_set_grow(stats))
+        return 0;
+    stats->set[alloc_set_slot(stats, ptr)] = ptr;
+    stats->set_nb++;
+    return 1;
+}
+
+/*
+** Linear probing delete: later entries of the run are shifted back so
+** no lookup ever stops early on the freed slot.
+*/
+int alloc_set_remove(alloc_stats_t *stats, void *ptr)
+{
+    size_t mask = stats->set_cap - 1;
+    size_t hole = 0;
+    size_t home = 0;
+
+    if (stats->set_cap == 0 || stats->set[alloc_set_slot(stats, ptr)] == NULL)
+        return 0;
+    hole = alloc_set_slot(stats, ptr);
+    stats->set[hole] = NULL;
+    stats->set_nb--;
+    for (size_t i = (hole + 1) & mask; stats->set[i] != NULL;
+        i = (i + 1) & mask) {
+        home = (((uintptr_t)stats->set[i] >> 4) * ALLOC_SET_MIX) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            stats->set[hole] = stats->set[i];
+            stats->set[i] = NULL;
+            hole = i;
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_alloc_stats
+*/
+
+#define MY_ALLOC_IMPL
+#include <string.h>
+#include "my.h"
+
+alloc_stats_t *alloc_stats(void)
+{
+    static alloc_stats_t stats = {0};
+
+    return &stats;
+}
+
+void alloc_stats_init(char **env)
+{
+    int len = my_strlen(ALLOC_ENV);
+
+    for (int i = 0; env != NULL && env[i] != NULL; i++)
+        if (my_strncmp(env[i], ALLOC_ENV, len) == 0)
+            alloc_stats()->enabled = 1;
+}
+
+/*
+** __FILE__ is one literal per translation unit, so the pointer alone
+** identifies the calling subsystem.
+*/
+int alloc_site(alloc_stats_t *stats, char const *file)
+{
+    int idx = ((unsigned long)file >> 3) % ALLOC_SITES;
+
+    for (int i = 0; i < ALLOC_SITES; i++) {
+        if (stats->sites[idx].file == file || stats->sites[idx].file == NULL) {
+            stats->sites[idx].file = file;
+            return idx;
+        }
+        idx = (idx + 1) % ALLOC_SITES;
+    }
+    return idx;
+}
+
+void alloc_add(alloc_count_t *count, long size, int sign)
+{
+    if (sign > 0) {
+        count->allocs++;
+        count->bytes += size;
+        count->live += size;
+    } else {
+        count->frees++;
+        count->live -= size;
+    }
+    if (count->live > count->peak)
+        count->peak = count->live;
+}
+
+void alloc_account(alloc_stats_t *stats, alloc_header_t *header, int sign)
+{
+    long size = header->size;
+
+    alloc_add(&stats->total, size, sign);
+    alloc_add(&stats->line, size, sign);
+    alloc_add(&stats->sites[header->site].count, size, sign);
+}
@@ -0,0 +1,21 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_getnbr
+*/
+
+#include "my.h"
+
+long my_getnbr(char const *str)
+{
+    long nb = 0;
+    int sign = 1;
+    int i = 0;
+
+    for (; str[i] == '-' || str[i] == '+'; i++)
+        sign *= (str[i] == '-') ? -1 : 1;
+    for (; str[i] >= '0' && str[i] <= '9'; i++)
+        nb = nb * 10 + (str[i] - '0');
+    return nb * sign;
+}
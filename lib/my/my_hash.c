@@ -0,0 +1,19 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_hash
+*/
+
+#include "my.h"
+
+unsigned long my_hash(char const *str)
+{
+    unsigned long hash = 14695981039346656037UL;
+
+    for (int i = 0; str[i] != '\0'; i++) {
+        hash ^= (unsigned char)str[i];
+        hash *= 1099511628211UL;
+    }
+    return hash;
+}
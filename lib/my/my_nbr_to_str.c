@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_nbr_to_str
+*/
+
+#include "my.h"
+
+int my_nbr_to_str(long nb, char *buf)
+{
+    unsigned long value = (nb < 0) ? -(unsigned long)nb : (unsigned long)nb;
+    int len = (nb < 0) ? 2 : 1;
+
+    for (unsigned long div = value; div >= 10; div /= 10)
+        len++;
+    if (buf == NULL)
+        return len;
+    if (nb < 0)
+        buf[0] = '-';
+    for (int i = len - 1; i >= (nb < 0); i--) {
+        buf[i] = '0' + value % 10;
+        value /= 10;
+    }
+    return len;
+}
@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_put_nbr_fd
+*/
+
+#include <unistd.h>
+#include "my.h"
+
+void my_put_nbr_fd(long nb, int fd)
+{
+    char c = 0;
+
+    if (nb < 0) {
+        write(fd, "-", 1);
+        nb = -nb;
+    }
+    if (nb >= 10)
+        my_put_nbr_fd(nb / 10, fd);
+    c = '0' + nb % 10;
+    write(fd, &c, 1);
+}
@@ -7,21 +7,37 @@
 
 #include "my.h"
 #include <stdlib.h>
+#include <string.h>
 
-char **my_split(char *str, char *separator)
+char *pack_token(char *dest, char const *src, int len)
 {
-    char **tab = NULL;
-    int nb_chars = 0;
-    int nb_to_skip = 0;
+    memcpy(dest, src, len);
+    dest[len] = '\0';
+    return dest + len + 1;
+}
+
+/*
+** The pointer array and the token bytes share one block: tokens never
+** need more room than the string itself, and one free() releases it all.
+*/
+char **my_split_at(char *str, char *separator, char const *file)
+{
+    charset_t seps = charset_make(separator);
+    int len = 0;
     int nb_words = count_words(str, separator);
+    size_t head = sizeof(char *) * (nb_words + 1);
+    char **tab = my_malloc(head + my_strlen(str) + 1, file);
+    char *dest = NULL;
+    char const *word = str;
 
-    tab = malloc(sizeof(char *) * (nb_words + 1));
-    str += my_strspn(str, separator);
+    if (tab == NULL)
+        return NULL;
+    dest = (char *)tab + head;
     for (int i = 0; i < nb_words; i++) {
-        nb_chars = my_strcspn(str, separator);
-        nb_to_skip = my_strspn(str + nb_chars, separator);
-        tab[i] = my_strndup(str, nb_chars);
-        str += nb_chars + nb_to_skip;
+        word = charset_token(&seps, word, &len);
+        tab[i] = dest;
+        dest = pack_token(dest, word, len);
+        word += len;
     }
     tab[nb_words] = NULL;
     return tab;
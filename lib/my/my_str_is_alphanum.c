@@ -9,15 +9,5 @@
 
 int my_str_is_alphanum(char *str)
 {
-    int i = 0;
-
-    while (str[i] != '\0') {
-        if ((str[i] >= 'a' && str[i] <= 'z')
-        || (str[i] >= 'A' && str[i] <= 'Z')
-        || (str[i] >= '0' && str[i] <= '9'))
-            i++;
-        else
-            return 1;
-    }
-    return 0;
+    return str[charset_span(charset_class(CHARSET_ALNUM), str)] != '\0';
 }
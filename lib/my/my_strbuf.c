@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_strbuf
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+
+/*
+** Short strings live in the inline buffer; the builder must not be copied
+** by value since str may point into itself.
+*/
+void sb_init(strbuf_t *sb)
+{
+    sb->str = sb->small;
+    sb->len = 0;
+    sb->cap = SB_INLINE;
+    sb->small[0] = '\0';
+}
+
+int sb_reserve(strbuf_t *sb, int extra)
+{
+    int cap = sb->cap;
+    char *grown = NULL;
+
+    if (sb->len + extra + 1 <= sb->cap)
+        return 0;
+    while (cap < sb->len + extra + 1)
+        cap *= 2;
+    grown = (sb->str == sb->small) ? malloc(cap) : realloc(sb->str, cap);
+    if (grown == NULL)
+        return 84;
+    if (sb->str == sb->small)
+        memcpy(grown, sb->small, sb->len + 1);
+    sb->str = grown;
+    sb->cap = cap;
+    return 0;
+}
+
+int sb_append(strbuf_t *sb, char const *str, int len)
+{
+    if (sb_reserve(sb, len) != 0)
+        return 84;
+    memcpy(sb->str + sb->len, str, len);
+    sb->len += len;
+    sb->str[sb->len] = '\0';
+    return 0;
+}
+
+char *sb_steal(strbuf_t *sb)
+{
+    char *str = sb->str;
+
+    if (str == sb->small)
+        str = my_strndup(sb->small, sb->len);
+    sb_init(sb);
+    return str;
+}
+
+void sb_free(strbuf_t *sb)
+{
+    if (sb->str != sb->small)
+        free(sb->str);
+    sb_init(sb);
+}
@@ -0,0 +1,32 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** my_strbuf_many
+*/
+
+#include <stdarg.h>
+#include "my.h"
+
+int sb_append_many(strbuf_t *sb, ...)
+{
+    va_list args;
+    char const *str = NULL;
+    int status = 0;
+
+    va_start(args, sb);
+    str = va_arg(args, char const *);
+    while (str != NULL && status == 0) {
+        status = sb_append(sb, str, my_strlen(str));
+        str = va_arg(args, char const *);
+    }
+    va_end(args);
+    return status;
+}
+
+char *sb_reset(strbuf_t *sb)
+{
+    sb->len = 0;
+    sb->str[0] = '\0';
+    return sb->str;
+}
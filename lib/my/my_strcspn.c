@@ -10,20 +10,7 @@
 
 int my_strcspn(char *str, char *acptd_chars)
 {
-    int len = 0;
-    int j = 0;
-    int i = 0;
+    charset_t set = charset_make(acptd_chars);
 
-    while (str[i] != '\0' || acptd_chars[j] != '\0') {
-        if (acptd_chars[j] == '\0') {
-            len++;
-            i++;
-            j = 0;
-        }
-        if (my_charcmp(str[i], acptd_chars[j]) == 0)
-            j++;
-        if (my_charcmp(str[i], acptd_chars[j]) == 1 || str[i] == '\0')
-            break;
-    }
-    return len;
+    return charset_cspan(&set, str);
 }
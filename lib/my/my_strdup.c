@@ -8,10 +8,10 @@
 #include "my.h"
 #include <stdlib.h>
 
-char *my_strdup(char *src)
+char *my_strdup_at(char *src, char const *file)
 {
     int i = 0;
-    char *str = malloc(sizeof(char) * (my_strlen(src) + 1));
+    char *str = my_malloc(sizeof(char) * (my_strlen(src) + 1), file);
 
     if (str == NULL)
         return NULL;
@@ -8,9 +8,9 @@
 #include "my.h"
 #include <stdlib.h>
 
-char *my_strndup(char *str, int n)
+char *my_strndup_at(char *str, int n, char const *file)
 {
-    char *dup = malloc(sizeof(char) + (n + 1));
+    char *dup = my_malloc(sizeof(char) + (n + 1), file);
     int i = 0;
 
     for (; str[i] && i < n; i++)
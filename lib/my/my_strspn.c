@@ -10,20 +10,7 @@
 
 int my_strspn(char *str, char *accepted_chars)
 {
-    int len = 0;
-    int j = 0;
-    int i = 0;
+    charset_t set = charset_make(accepted_chars);
 
-    while (str[i] != '\0' || accepted_chars[j] != '\0') {
-        if (str[i] == accepted_chars[j]) {
-            len++;
-            i++;
-            j = 0;
-        }
-        if (my_charcmp(str[i], accepted_chars[j]) == 0)
-            j++;
-        if (accepted_chars[j] == '\0')
-            break;
-    }
-    return len;
+    return charset_span(&set, str);
 }
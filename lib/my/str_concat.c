@@ -8,11 +8,11 @@
 #include <stdio.h>
 #include "my.h"
 
-char *str_concat(char *dest, char const *src)
+char *str_concat_at(char *dest, char const *src, char const *file)
 {
     int i = 0;
     int both_str_len = my_strlen(src) + my_strlen(dest);
-    char *final_string = malloc(sizeof(char) * both_str_len + 1);
+    char *final_string = my_malloc(sizeof(char) * both_str_len + 1, file);
 
     for (int k = 0; dest[k] != '\0'; k++) {
         final_string[i] = dest[k];
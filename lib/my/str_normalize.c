@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2022
+** my
+** File description:
+** str_normalize
+*/
+
+#include <string.h>
+#include "my.h"
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+/*
+** Length of the leading run without any separator; SSE2 tests sixteen
+** bytes per step against every separator before the byte loop finishes.
+*/
+int str_norm_span(char const *str, int len, char const *seps)
+{
+    int i = 0;
+#ifdef __SSE2__
+    __m128i chunk;
+    int mask = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        chunk = _mm_loadu_si128((__m128i const *)(str + i));
+        mask = 0;
+        for (int k = 0; seps[k] != '\0'; k++)
+            mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(chunk,
+                _mm_set1_epi8(seps[k])));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    while (i < len && strchr(seps, str[i]) == NULL)
+        i++;
+    return i;
+}
+
+/*
+** Trims the string and turns every run of separators into one space,
+** in place: the output is never longer than the input.
+*/
+char *str_normalize(char *str, char const *seps)
+{
+    int len = my_strlen(str);
+    int i = 0;
+    int j = 0;
+    int span = 0;
+
+    while (i < len) {
+        span = str_norm_span(str + i, len - i, seps);
+        if (span == 0) {
+            i++;
+            continue;
+        }
+        if (j > 0)
+            str[j++] = ' ';
+        memmove(str + j, str + i, span);
+        j += span;
+        i += span;
+    }
+    str[j] = '\0';
+    return str;
+}
@@ -15,32 +15,36 @@
 #include "my.h"
 #include "my_minishell.h"
 
-int child_pid_f(void)
-{
-    int child_pid = fork();
-
-    return (child_pid);
-}
-
 int part_one_builtin(char **input, env_t *env_cpy)
 {
     if (my_strcmp(input[0], "cd") == 0)
-        my_cd(input, env_cpy);
+        builtin_status(env_cpy, my_cd(input, env_cpy));
     if (my_strcmp(input[0], "exit") == 0)
-        exit(0);
+        builtin_status(env_cpy, my_exit(input, env_cpy));
     if (my_strcmp(input[0], "env") == 0)
-        my_env(env_cpy);
+        my_env(input, env_cpy);
+    if (my_strcmp(input[0], "timeout") == 0)
+        my_timeout(input, env_cpy);
+    if (my_strcmp(input[0], "batch") == 0)
+        my_batch(input, env_cpy);
     return 84;
 }
 
 int part_two_builtin(char **input, env_t *env_cpy, bool forkable)
 {
+    int ret = 0;
+
     if (my_strcmp(input[0], "setenv") == 0)
-        if (my_setenv(env_cpy, input) == 0)
+        if (builtin_status(env_cpy, my_setenv(env_cpy, input)) == 0)
             return 0;
     if (my_strcmp(input[0], "unsetenv") == 0)
-        if (my_unsetenv(env_cpy, input) == 0)
+        if (builtin_status(env_cpy, my_unsetenv(env_cpy, input)) == 0)
             return 0;
+    ret = part_three_builtin(input, env_cpy);
+    if (ret != -1) {
+        builtin_status(env_cpy, ret);
+        return 0;
+    }
     if (CONDITION)
         all_bins_function(input[0], input, env_cpy, forkable);
     return 84;
@@ -48,33 +52,37 @@ int part_two_builtin(char **input, env_t *env_cpy, bool forkable)
 
 void run_mysh(env_t *env_cpy)
 {
-    size_t n = 0;
     char *buffer = NULL;
-    char **array_coma = NULL;
+    bool interactive = env_cpy->loop != NULL && env_cpy->loop->interactive;
 
-    if (getline(&buffer, &n, stdin) == -1)
-        exit(0);
-    if (my_strcmp(buffer, "\n") != 0) {
-        array_coma = get_array_inputs_coma(buffer);
-        parse_on_pipe(array_coma, env_cpy);
+    alloc_stats_line_start();
+    buffer = read_line(env_cpy);
+    if (buffer == NULL)
+        mysh_exit(env_cpy, env_cpy->last_status);
+    stat_cache_flush(env_cpy->stat_cache);
+    arena_reset(env_cpy->line_arena);
+    if (interactive)
+        buffer = hist_expand(env_cpy, buffer);
+    if (buffer != NULL && my_strcmp(buffer, "\n") != 0) {
+        if (interactive)
+            hist_add(env_cpy->history, buffer, my_strlen(buffer) - 1);
+        parse_line(buffer, env_cpy);
     }
+    alloc_stats_line_end();
 }
 
 int main(int argc, char **argv, char **env)
 {
     (void)argv;
     int tty = 1;
-    env_t *env_cpy = malloc(sizeof(env_t));
-    env_cpy->env_copy = dup_entire_array(env);
-    env_cpy->old_pwd = NULL;
-    env_cpy->pwd = NULL;
+    env_t *env_cpy = NULL;
+
+    alloc_stats_init(env);
+    env_cpy = init_env(env);
 
     if (argc != 1)
         return 84;
-    while (tty) {
-        if (isatty(0))
-            my_putstr("[Redshell]$> ");
+    while (tty)
         run_mysh(env_cpy);
-    }
     return 0;
 }
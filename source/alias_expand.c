@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** alias_expand
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+char **alias_splice(env_t *env_cpy, alias_entry_t *entry, char **input)
+{
+    int len = my_array_len(input);
+    char **argv = arena_alloc(env_cpy->line_arena,
+        sizeof(char *) * (entry->nb_words + len));
+    int k = 0;
+
+    if (argv == NULL)
+        return NULL;
+    for (int i = 0; i < entry->nb_words; i++)
+        argv[k++] = entry->words[i];
+    for (int i = 1; i < len; i++)
+        argv[k++] = input[i];
+    argv[k] = NULL;
+    return argv;
+}
+
+bool alias_seen(alias_entry_t **seen, int depth, alias_entry_t *entry)
+{
+    for (int i = 0; i < depth; i++) {
+        if (seen[i] == entry)
+            return true;
+    }
+    return false;
+}
+
+char **expand_alias(char **input, env_t *env_cpy)
+{
+    alias_entry_t *seen[ALIAS_MAX_DEPTH];
+    alias_entry_t *entry = NULL;
+    int depth = 0;
+
+    if (env_cpy->aliases->nb_aliases == 0)
+        return input;
+    while (input != NULL && input[0] != NULL) {
+        entry = alias_find(env_cpy->aliases, input[0]);
+        if (entry == NULL || (depth > 0 && seen[depth - 1] == entry))
+            return input;
+        if (depth == ALIAS_MAX_DEPTH || alias_seen(seen, depth, entry)) {
+            my_putstr_err("Alias loop.\n");
+            return NULL;
+        }
+        seen[depth++] = entry;
+        input = alias_splice(env_cpy, entry, input);
+    }
+    return input;
+}
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** alias_table
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+alias_table_t *alias_table_new(void)
+{
+    alias_table_t *table = malloc(sizeof(alias_table_t));
+
+    if (table == NULL)
+        return NULL;
+    for (int i = 0; i < ALIAS_TABLE_SIZE; i++)
+        table->buckets[i] = NULL;
+    table->nb_aliases = 0;
+    return table;
+}
+
+alias_entry_t *alias_find(alias_table_t *table, char const *name)
+{
+    alias_entry_t *entry = NULL;
+
+    if (table->nb_aliases == 0)
+        return NULL;
+    entry = table->buckets[my_hash(name) % ALIAS_TABLE_SIZE];
+    for (; entry != NULL; entry = entry->next) {
+        if (my_strcmp(entry->name, name) == 0)
+            return entry;
+    }
+    return NULL;
+}
+
+void alias_entry_clear(alias_entry_t *entry)
+{
+    free_array(entry->words);
+    MY_FREE(entry->text);
+}
+
+void alias_set(alias_table_t *table, char *name, char **words)
+{
+    alias_entry_t *entry = alias_find(table, name);
+    unsigned long bucket = my_hash(name) % ALIAS_TABLE_SIZE;
+
+    if (entry == NULL) {
+        entry = malloc(sizeof(alias_entry_t));
+        if (entry == NULL)
+            return;
+        entry->name = my_strdup(name);
+        entry->next = table->buckets[bucket];
+        table->buckets[bucket] = entry;
+        table->nb_aliases++;
+    } else
+        alias_entry_clear(entry);
+    entry->words = dup_entire_array(words);
+    entry->nb_words = my_array_len(words);
+    entry->text = words[0];
+    for (int i = 1; words[i] != NULL; i++)
+        entry->text = str_concat(str_concat(entry->text, " "), words[i]);
+    entry->text = my_strdup(entry->text);
+}
+
+void alias_unset(alias_table_t *table, char *name)
+{
+    alias_entry_t **link = &table->buckets[my_hash(name) % ALIAS_TABLE_SIZE];
+    alias_entry_t *entry = NULL;
+
+    for (; *link != NULL; link = &(*link)->next) {
+        if (my_strcmp((*link)->name, name) != 0)
+            continue;
+        entry = *link;
+        *link = entry->next;
+        alias_entry_clear(entry);
+        MY_FREE(entry->name);
+        MY_FREE(entry);
+        table->nb_aliases--;
+        return;
+    }
+}
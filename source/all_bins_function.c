@@ -27,56 +27,48 @@ void execute_order_66(char *path, char **input, env_t *env_cpy, bool forkable)
     int status = 0;
 
     if (forkable) {
-        pid = fork();
+        pid = mysh_fork(env_cpy);
         if (pid == 0) {
-            execve(path, input, env_cpy->env_copy);
-            exit(84);
+            mysh_exec(env_cpy, path, input);
+            exec_failed(env_cpy, input[0]);
         }
-        waitpid(pid, &status, WUNTRACED);
+        mysh_waitpid(env_cpy, pid, &status, WUNTRACED);
+        wait_status(env_cpy, status);
     } else {
-        execve(path, input, env_cpy->env_copy);
-        exit(84);
+        mysh_exec(env_cpy, path, input);
+        exec_failed(env_cpy, input[0]);
     }
 }
 
-int some_errs(char *indication, char **input,
-                env_t *env_cpy, struct stat file_info)
+int some_errs(char *indication, char **input, env_t *env_cpy)
 {
-    if (S_ISDIR(file_info.st_mode)) {
+    struct stat file_info;
+
+    if (cached_stat(env_cpy, indication, &file_info) == 0 &&
+        S_ISDIR(file_info.st_mode)) {
         my_putstr_err(indication);
         my_putstr_err(": Permission denied.\n");
+        env_cpy->last_status = 1;
         return (84);
     }
-    if (access(indication, X_OK) != -1) {
+    if (cached_access(env_cpy, indication, X_OK) != -1) {
         execute_order_66(indication, input, env_cpy, true);
         return (1);
     }
-    if (access(indication, X_OK) == -1)
-        error_message(input);
+    error_message(input);
+    env_cpy->last_status = 1;
     return (84);
 }
 
 int all_bins_function(char *indication, char **input,
                     env_t *env_cpy, bool forkable)
 {
-    char **path_tab = my_split(my_getenv("PATH", env_cpy), ":");
-    char *final_path = NULL;
-    int i = 0;
-    int nb_path = nb_occ_strstr(my_getenv("PATH", env_cpy), ":");
-    struct stat file_info;
-
-    stat(indication, &file_info);
-    for (; access(create_path_ez(path_tab[i], indication), X_OK) == -1 &&
-            i < nb_path; i++);
-    if (access(create_path_ez(path_tab[i], indication), X_OK) != -1) {
-        final_path = create_path_ez(path_tab[i], indication);
-        execute_order_66(final_path, input, env_cpy, forkable);
-        free_array(path_tab);
+    if (str_contain_char(indication, '/') != 0 &&
+        cmd_locate(env_cpy, indication) != -1) {
+        execute_order_66(indication, input, env_cpy, forkable);
         return (1);
     }
-    free_array(path_tab);
-    for (; access(indication, X_OK) == -1 && i < nb_path; i++);
-    if (some_errs(indication, input, env_cpy, file_info) == 1)
+    if (some_errs(indication, input, env_cpy) == 1)
         return (1);
     return (84);
 }
@@ -25,6 +25,7 @@ int cd_only(char **input, env_t *env_cpy, char *current_dir)
         update_oldpwd(env_cpy, current_dir);
         update_pwd(env_cpy, path);
         chdir(path);
+        cwd_changed(env_cpy);
         MY_FREE(path);
         current_dir = getcwd(NULL, 0);
         return 0;
@@ -32,19 +33,15 @@ int cd_only(char **input, env_t *env_cpy, char *current_dir)
     return 1;
 }
 
-int cd_on_folder(char **input, env_t *env_cpy,
-                char *current_dir, struct stat statbuffer)
+int cd_on_folder(char **input, env_t *env_cpy, char *current_dir)
 {
-    char *new_command = NULL;
-
-    if (access(input[1], R_OK) != 0) {
+    if (cached_access(env_cpy, input[1], R_OK) != 0) {
         my_putstr_err(input[1]);
         my_putstr_err(": Permission denied.\n");
         return (84);
     }
-    if ((chdir(input[1]) == 0) && (is_it_dir(input[1], statbuffer) == 0)) {
-        new_command = input[1];
-        chdir(new_command);
+    if ((is_it_dir(env_cpy, input[1]) == 0) && (chdir(input[1]) == 0)) {
+        cwd_changed(env_cpy);
         current_dir = getcwd(NULL, 0);
         update_oldpwd(env_cpy, current_dir);
         update_pwd(env_cpy, current_dir);
@@ -53,14 +50,10 @@ int cd_on_folder(char **input, env_t *env_cpy,
     return 1;
 }
 
-int cd_another(char *path, env_t *env_cpy,
-            char *current_dir, struct stat statbuffer)
+int cd_another(char *path, env_t *env_cpy, char *current_dir)
 {
-    char *new_command = NULL;
-
-    if ((chdir(path) == 0) && (is_it_dir(path, statbuffer) == 0)) {
-        new_command = path;
-        chdir(new_command);
+    if ((is_it_dir(env_cpy, path) == 0) && (chdir(path) == 0)) {
+        cwd_changed(env_cpy);
         current_dir = getcwd(NULL, 0);
         update_oldpwd(env_cpy, current_dir);
         update_pwd(env_cpy, current_dir);
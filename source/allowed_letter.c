@@ -15,29 +15,7 @@
 #include "my.h"
 #include "my_minishell.h"
 
-bool condition(char *str, int i, int j, char *aphbet)
-{
-    while (str[i] != aphbet[j]) {
-        j++;
-        if (aphbet[j] == '\0')
-            return false;
-    }
-    return true;
-}
-
 bool allowed_letter(char *str)
 {
-    int i = 0;
-    int j = 0;
-    char *aphbet = str_concat(ALPHABET, EXT_ALPHABET);
-
-    while (str[i] != '\0') {
-        if (str[i] == aphbet[j]) {
-            i++;
-            j = 0;
-        }
-        if (condition(str, i, j, aphbet) == false)
-            return false;
-    }
-    return true;
+    return str[charset_span(charset_class(CHARSET_FILE), str)] == '\0';
 }
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** arena
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+arena_t *arena_new(void)
+{
+    arena_t *arena = malloc(sizeof(arena_t));
+
+    if (arena == NULL)
+        return NULL;
+    arena->head = NULL;
+    arena->maps = NULL;
+    return arena;
+}
+
+arena_block_t *arena_block_new(arena_t *arena, size_t size)
+{
+    arena_block_t *block = NULL;
+
+    if (size < ARENA_BLOCK_SIZE)
+        size = ARENA_BLOCK_SIZE;
+    block = malloc(sizeof(arena_block_t) + size);
+    if (block == NULL)
+        return NULL;
+    block->size = size;
+    block->used = 0;
+    block->next = arena->head;
+    arena->head = block;
+    return block;
+}
+
+void *arena_alloc(arena_t *arena, size_t size)
+{
+    arena_block_t *block = arena->head;
+    void *ptr = NULL;
+
+    size = (size + 15) & ~(size_t)15;
+    if (block == NULL || block->used + size > block->size)
+        block = arena_block_new(arena, size);
+    if (block == NULL)
+        return NULL;
+    ptr = block->data + block->used;
+    block->used += size;
+    return ptr;
+}
+
+void arena_reset(arena_t *arena)
+{
+    arena_block_t *block = arena->head;
+    arena_block_t *next = NULL;
+
+    arena_map_release(arena);
+    if (block == NULL)
+        return;
+    for (next = block->next; next != NULL; next = block->next) {
+        block->next = next->next;
+        MY_FREE(next);
+    }
+    block->used = 0;
+}
+
+char *arena_strndup(arena_t *arena, char const *str, int len)
+{
+    char *dup = arena_alloc(arena, len + 1);
+
+    if (dup == NULL)
+        return NULL;
+    for (int i = 0; i < len; i++)
+        dup[i] = str[i];
+    dup[len] = '\0';
+    return dup;
+}
@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** arena_map
+*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "my.h"
+#include "my_minishell.h"
+
+arena_map_t *arena_map_new(arena_t *arena, size_t size)
+{
+    arena_map_t *map = arena_alloc(arena, sizeof(arena_map_t));
+
+    if (map == NULL)
+        return NULL;
+    map->data = mmap(NULL, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map->data == MAP_FAILED)
+        return NULL;
+    map->size = size;
+    map->next = arena->maps;
+    arena->maps = map;
+    return map;
+}
+
+/*
+** mremap moves the pages instead of copying them, so a capture that
+** keeps growing is never copied while it is being read.
+*/
+bool arena_map_grow(arena_map_t *map, size_t size)
+{
+    char *data = mremap(map->data, map->size, size, MREMAP_MAYMOVE);
+
+    if (data == MAP_FAILED)
+        return false;
+    map->data = data;
+    map->size = size;
+    return true;
+}
+
+void arena_map_release(arena_t *arena)
+{
+    for (arena_map_t *map = arena->maps; map != NULL; map = map->next)
+        munmap(map->data, map->size);
+    arena->maps = NULL;
+}
@@ -17,15 +17,9 @@
 
 char **array_inputs_nmrs_gtl(char *buffer)
 {
-    char **array_one = {0};
-    char *first_step_array = my_strdup(buffer);
-    int i = 0;
+    char **array_one = my_split(buffer, "\n");
 
-    array_one = my_split(first_step_array, "\n");
-    while (array_one[i] != NULL) {
-        first_step_array = turn_sep_to_spaces(first_step_array, '\t');
-        first_step_array = str_cleaner(first_step_array, ' ');
-        i++;
-    }
+    for (int i = 0; array_one != NULL && array_one[i] != NULL; i++)
+        str_normalize(array_one[i], " \t");
     return array_one;
 }
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** batch_input
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int batch_number(char const *str)
+{
+    int nb = (my_str_isnum(str) == 0) ? my_getnbr(str) : 0;
+
+    return (nb > 0) ? nb : -1;
+}
+
+int batch_skip_words(char **input, int arg)
+{
+    while (input[arg] != NULL && my_strcmp(input[arg], "--") != 0)
+        arg++;
+    return (input[arg] == NULL) ? arg : arg + 1;
+}
+
+long batch_lines(env_t *env_cpy, batch_t *batch, char *buf, size_t len)
+{
+    size_t start = 0;
+    char *end = NULL;
+
+    while (start < len) {
+        end = memchr(buf + start, '\n', len - start);
+        if (end == NULL)
+            break;
+        if (end > buf + start &&
+            batch_add(env_cpy, batch, buf + start, end - buf - start) != 0)
+            return -1;
+        start = end - buf + 1;
+    }
+    if (start == 0 && len == BATCH_READ)
+        return (batch_add(env_cpy, batch, buf, len) == 0) ? 0 : -1;
+    return start;
+}
+
+/*
+** One item per line; batches are launched while the rest of the input
+** is still being read.
+*/
+int batch_read(env_t *env_cpy, batch_t *batch)
+{
+    char *buf = malloc(BATCH_READ);
+    size_t len = 0;
+    ssize_t got = 1;
+    long used = 0;
+
+    if (buf == NULL)
+        return 84;
+    while (used != -1 && got > 0) {
+        got = read(STDIN_FILENO, buf + len, BATCH_READ - len);
+        len += (got > 0) ? got : 0;
+        used = batch_lines(env_cpy, batch, buf, len);
+        if (used > 0) {
+            memmove(buf, buf + used, len - used);
+            len -= used;
+        }
+    }
+    if (used != -1 && len > 0)
+        used = (batch_add(env_cpy, batch, buf, len) == 0) ? 0 : -1;
+    MY_FREE(buf);
+    return (used == -1) ? 84 : 0;
+}
+
+int batch_words(env_t *env_cpy, batch_t *batch, char **words)
+{
+    int ret = 0;
+
+    for (int i = 0; ret == 0 && words[i] != NULL &&
+        my_strcmp(words[i], "--") != 0; i++)
+        ret = batch_add(env_cpy, batch, words[i], my_strlen(words[i]));
+    return ret;
+}
@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** batch_pack
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <limits.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** execve counts every string with its terminator and its argv or envp
+** slot against ARG_MAX, so that is what is charged for each item.
+*/
+long batch_budget(env_t *env_cpy, char **cmd)
+{
+    long budget = sysconf(_SC_ARG_MAX);
+    char **envp = exec_envp(env_cpy);
+
+    if (budget <= 0)
+        budget = _POSIX_ARG_MAX;
+    budget -= BATCH_HEADROOM + 2 * sizeof(char *);
+    for (int i = 0; envp[i] != NULL; i++)
+        budget -= my_strlen(envp[i]) + 1 + sizeof(char *);
+    for (int i = 0; cmd[i] != NULL; i++)
+        budget -= my_strlen(cmd[i]) + 1 + sizeof(char *);
+    return budget;
+}
+
+char **batch_argv(batch_t *batch)
+{
+    int need = batch->nb_cmd + batch->items.nb + 1;
+    char **argv = batch->argv;
+
+    if (need > batch->cap_argv) {
+        argv = realloc(batch->argv, sizeof(char *) * need);
+        if (argv == NULL)
+            return NULL;
+        batch->argv = argv;
+        batch->cap_argv = need;
+    }
+    for (int i = 0; i < batch->nb_cmd; i++)
+        argv[i] = batch->cmd[i];
+    for (int i = 0; i < batch->items.nb; i++)
+        argv[batch->nb_cmd + i] = batch->items.buf + batch->items.offs[i];
+    argv[need - 1] = NULL;
+    return argv;
+}
+
+void batch_reset(batch_t *batch)
+{
+    batch->items.len = 0;
+    batch->items.nb = 0;
+    batch->used = 0;
+}
+
+/*
+** Items are copied back to back into the batch's single buffer; a full
+** batch is launched before the item that would overflow it.
+*/
+int batch_add(env_t *env_cpy, batch_t *batch, char const *item, size_t len)
+{
+    long cost = len + 1 + sizeof(char *);
+    bool full = batch->used + cost > batch->budget ||
+        batch->items.nb == batch->max_items;
+
+    if (cost > batch->budget || len >= BATCH_READ) {
+        my_putstr_err("batch: Argument too long.\n");
+        return 84;
+    }
+    if (full && batch_flush(env_cpy, batch) != 0)
+        return 84;
+    if (!glob_list_push(&batch->items, "", item, len))
+        return 84;
+    batch->used += cost;
+    return 0;
+}
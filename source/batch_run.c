@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** batch_run
+*/
+
+#include <fcntl.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void batch_child(env_t *env_cpy, batch_t *batch, char **argv)
+{
+    int null_fd = -1;
+
+    if (batch->from_stdin) {
+        null_fd = open("/dev/null", O_RDONLY);
+        if (null_fd != -1) {
+            dup2(null_fd, STDIN_FILENO);
+            close(null_fd);
+        }
+    }
+    run_argv(argv, env_cpy, false);
+    mysh_exit(env_cpy, env_cpy->last_status);
+}
+
+void batch_collect(env_t *env_cpy, batch_t *batch, int slot)
+{
+    int status = 0;
+
+    mysh_waitpid(env_cpy, batch->pids[slot], &status, 0);
+    if (status != 0)
+        batch->failed = true;
+    batch->running--;
+    batch->pids[slot] = batch->pids[batch->running];
+}
+
+int batch_done(event_loop_t *loop, batch_t *batch)
+{
+    child_t *child = NULL;
+
+    for (int i = 0; i < batch->running; i++) {
+        child = child_find(loop, batch->pids[i], -1);
+        if (child == NULL || child->done)
+            return i;
+        deadline_check(&loop->deadline, child);
+    }
+    return -1;
+}
+
+/*
+** Frees one job slot: whichever batch finishes first, not the oldest.
+*/
+void batch_reap(env_t *env_cpy, batch_t *batch)
+{
+    event_loop_t *loop = env_cpy->loop;
+    int slot = -1;
+
+    while (loop != NULL && (slot = batch_done(loop, batch)) == -1)
+        loop_wait(env_cpy, deadline_timeout(&loop->deadline));
+    batch_collect(env_cpy, batch, (slot == -1) ? 0 : slot);
+}
+
+int batch_flush(env_t *env_cpy, batch_t *batch)
+{
+    char **argv = NULL;
+    pid_t pid = 0;
+
+    if (batch->items.nb == 0)
+        return 0;
+    if (env_cpy->loop != NULL && env_cpy->loop->interrupted)
+        return 84;
+    argv = batch_argv(batch);
+    if (argv == NULL)
+        return 84;
+    if (batch->running == batch->jobs)
+        batch_reap(env_cpy, batch);
+    pid = mysh_fork(env_cpy);
+    if (pid == 0)
+        batch_child(env_cpy, batch, argv);
+    if (pid == -1) {
+        my_putstr_err("batch: Cannot fork.\n");
+        return 84;
+    }
+    batch->pids[batch->running++] = pid;
+    batch_reset(batch);
+    return 0;
+}
@@ -0,0 +1,28 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** build_argv
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+char **build_argv(char *command, env_t *env_cpy)
+{
+    char **input = get_array_inputs(command);
+
+    if (input == NULL || input[0] == NULL)
+        return input;
+    input = expand_alias(input, env_cpy);
+    if (input == NULL)
+        return NULL;
+    input = expand_vars(input, env_cpy);
+    if (input == NULL)
+        return NULL;
+    input = subst_inputs(input, env_cpy);
+    if (input == NULL)
+        return NULL;
+    return glob_inputs(input);
+}
@@ -21,7 +21,8 @@ int cd_minus(char **input, env_t *env_cpy, char *current_dir)
             my_putstr_err(": No such file or directory.\n");
             return 0;
         } else {
-            chdir(my_getenv("OLDPWD", env_cpy));
+            chdir(env_view(env_cpy, "OLDPWD").value);
+            cwd_changed(env_cpy);
             current_dir = getcwd(NULL, 0);
             update_oldpwd(env_cpy, current_dir);
             update_pwd(env_cpy, current_dir);
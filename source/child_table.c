@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** child_table
+*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/pidfd.h>
+#include <sys/wait.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void child_track(event_loop_t *loop, pid_t pid)
+{
+    child_t *child = NULL;
+    struct epoll_event ev = {EPOLLIN, {0}};
+    int pidfd = (loop == NULL) ? -1 : pidfd_open(pid, 0);
+
+    if (pidfd == -1)
+        return;
+    child = malloc(sizeof(child_t));
+    ev.data.fd = pidfd;
+    if (child == NULL ||
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, pidfd, &ev) == -1) {
+        MY_FREE(child);
+        close(pidfd);
+        return;
+    }
+    *child = (child_t){pid, pidfd, 0, false, false, loop->children};
+    loop->children = child;
+}
+
+child_t *child_find(event_loop_t *loop, pid_t pid, int pidfd)
+{
+    if (loop == NULL)
+        return NULL;
+    for (child_t *child = loop->children; child != NULL;
+        child = child->next) {
+        if ((pid != -1 && child->pid == pid) ||
+            (pidfd != -1 && child->pidfd == pidfd))
+            return child;
+    }
+    return NULL;
+}
+
+int child_status(siginfo_t *info)
+{
+    if (info->si_code == CLD_EXITED)
+        return (info->si_status & 0xff) << 8;
+    if (info->si_code == CLD_KILLED)
+        return info->si_status & 0x7f;
+    if (info->si_code == CLD_DUMPED)
+        return (info->si_status & 0x7f) | 0x80;
+    return ((info->si_status & 0xff) << 8) | 0x7f;
+}
+
+/*
+** Called as soon as a pidfd turns readable, so nothing lingers as a
+** zombie; a child nobody waits for any more is dropped on the spot.
+*/
+void child_reap(event_loop_t *loop, child_t *child)
+{
+    siginfo_t info;
+
+    memset(&info, 0, sizeof(info));
+    if (waitid(P_PIDFD, child->pidfd, &info, WEXITED | WNOHANG) == -1 ||
+        info.si_pid == 0)
+        return;
+    child->status = child_status(&info);
+    child->done = true;
+    epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, child->pidfd, NULL);
+    close(child->pidfd);
+    child->pidfd = -1;
+    if (child->detached)
+        child_forget(loop, child);
+}
+
+void child_forget(event_loop_t *loop, child_t *child)
+{
+    child_t **link = &loop->children;
+
+    while (*link != NULL && *link != child)
+        link = &(*link)->next;
+    if (*link == NULL)
+        return;
+    *link = child->next;
+    if (child->pidfd != -1) {
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, child->pidfd, NULL);
+        close(child->pidfd);
+    }
+    MY_FREE(child);
+}
@@ -0,0 +1,81 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** cmd_cache
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+cmd_entry_t *cmd_cache_find(cmd_cache_t *cache, char *name)
+{
+    cmd_entry_t *entry = cache->buckets[my_hash(name) % CMD_CACHE_SIZE];
+
+    for (; entry != NULL; entry = entry->next) {
+        if (my_strcmp(entry->name, name) == 0)
+            return entry;
+    }
+    return NULL;
+}
+
+cmd_entry_t *cmd_cache_add(cmd_cache_t *cache, char *name, int dir)
+{
+    unsigned long bucket = my_hash(name) % CMD_CACHE_SIZE;
+    cmd_entry_t *entry = malloc(sizeof(cmd_entry_t));
+
+    if (entry == NULL)
+        return NULL;
+    entry->name = my_strdup(name);
+    entry->dir = dir;
+    entry->next = cache->buckets[bucket];
+    cache->buckets[bucket] = entry;
+    return entry;
+}
+
+void cmd_cache_drop_name(cmd_cache_t *cache, char *name)
+{
+    cmd_entry_t **link = &cache->buckets[my_hash(name) % CMD_CACHE_SIZE];
+    cmd_entry_t *entry = NULL;
+
+    cache->generation++;
+    for (; *link != NULL; link = &(*link)->next) {
+        if (my_strcmp((*link)->name, name) == 0) {
+            entry = *link;
+            *link = entry->next;
+            MY_FREE(entry->name);
+            MY_FREE(entry);
+            return;
+        }
+    }
+}
+
+void drop_bucket_from(cmd_entry_t **link, int dir)
+{
+    cmd_entry_t *entry = NULL;
+
+    while (*link != NULL) {
+        if ((*link)->dir >= dir || (*link)->dir == -1) {
+            entry = *link;
+            *link = entry->next;
+            MY_FREE(entry->name);
+            MY_FREE(entry);
+        } else {
+            link = &(*link)->next;
+        }
+    }
+}
+
+/*
+** Forget every lookup that a change in PATH directory `dir` may affect:
+** hits in that directory, hits it may now shadow, and all misses.
+** Passing 0 empties the whole table.
+*/
+void cmd_cache_drop_from(cmd_cache_t *cache, int dir)
+{
+    cache->generation++;
+    for (int i = 0; i < CMD_CACHE_SIZE; i++)
+        drop_bucket_from(&cache->buckets[i], dir);
+}
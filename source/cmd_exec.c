@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** cmd_exec
+*/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** execveat on a close-on-exec dirfd leaves a script's interpreter with an
+** unreachable /dev/fd path and fails with ENOENT before anything is
+** replaced, so that case retries with the full path.
+*/
+void path_dir_exec(env_t *env_cpy, path_dir_t *dir, char *name,
+    char **input)
+{
+    strbuf_t sb;
+    char *path = NULL;
+
+    if (dir->fd != -1) {
+        execveat(dir->fd, name, input, exec_envp(env_cpy), 0);
+        if (errno != ENOENT)
+            return;
+    }
+    sb_init(&sb);
+    path = create_path_ez(&sb, dir->path, name);
+    if (path != NULL)
+        execve(path, input, exec_envp(env_cpy));
+    sb_free(&sb);
+}
+
+void mysh_exec(env_t *env_cpy, char *path, char **input)
+{
+    cmd_cache_t *cache = env_cpy->cmd_cache;
+    cmd_entry_t *entry = NULL;
+
+    loop_restore_mask(env_cpy->loop);
+    if (my_strchr(path, '/') == NULL)
+        entry = cmd_cache_find(cache, path);
+    if (entry != NULL && entry->dir >= 0 && entry->dir < cache->nb_dirs)
+        path_dir_exec(env_cpy, &cache->dirs[entry->dir], path, input);
+    else
+        execve(path, input, exec_envp(env_cpy));
+}
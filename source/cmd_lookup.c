@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** cmd_lookup
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include "my.h"
+#include "my_minishell.h"
+
+cmd_cache_t *cmd_cache_new(void)
+{
+    cmd_cache_t *cache = malloc(sizeof(cmd_cache_t));
+
+    if (cache == NULL)
+        return NULL;
+    for (int i = 0; i < CMD_CACHE_SIZE; i++)
+        cache->buckets[i] = NULL;
+    cache->dirs = NULL;
+    cache->nb_dirs = 0;
+    cache->path_value = NULL;
+    cache->generation = 0;
+    cache->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    return cache;
+}
+
+void cmd_cache_sync(env_t *env_cpy)
+{
+    cmd_cache_t *cache = env_cpy->cmd_cache;
+    env_view_t path = env_view(env_cpy, "PATH");
+    char *path_value = (path.value == NULL) ? "" : path.value;
+
+    if (cache->path_value == NULL ||
+        my_strcmp(cache->path_value, path_value) != 0)
+        path_dirs_build(cache, path_value);
+    path_watch_drain(cache);
+    path_dirs_poll(cache);
+}
+
+int cmd_resolve(env_t *env_cpy, char *name)
+{
+    cmd_cache_t *cache = env_cpy->cmd_cache;
+
+    for (int i = 0; i < cache->nb_dirs; i++) {
+        if (path_dir_has(env_cpy, &cache->dirs[i], name))
+            return i;
+    }
+    return -1;
+}
+
+int cmd_locate(env_t *env_cpy, char *name)
+{
+    cmd_cache_t *cache = env_cpy->cmd_cache;
+    cmd_entry_t *entry = NULL;
+
+    cmd_cache_sync(env_cpy);
+    entry = cmd_cache_find(cache, name);
+    if (entry == NULL)
+        entry = cmd_cache_add(cache, name, cmd_resolve(env_cpy, name));
+    return (entry == NULL) ? -1 : entry->dir;
+}
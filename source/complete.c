@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** complete
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int le_word_start(line_edit_t *le)
+{
+    int start = le->pos;
+
+    while (start > 0 && strchr(" \t;|&<>(", le->buf[start - 1]) == NULL)
+        start--;
+    return start;
+}
+
+bool le_command_word(line_edit_t *le, int start)
+{
+    while (start > 0 && (le->buf[start - 1] == ' ' ||
+        le->buf[start - 1] == '\t'))
+        start--;
+    return start == 0 || strchr(";|&(", le->buf[start - 1]) != NULL;
+}
+
+void complete_insert(line_edit_t *le, complete_match_t *match)
+{
+    char *name = match->names[match->first];
+    int dir_len = 0;
+    char *path = NULL;
+    struct stat info;
+
+    le_insert(le, name + match->typed, complete_common(match) - match->typed);
+    if (match->nb != 1)
+        return;
+    if (match->dir == NULL) {
+        le_insert(le, " ", 1);
+        return;
+    }
+    dir_len = my_strlen(match->dir);
+    path = malloc(dir_len + my_strlen(name) + 1);
+    if (path == NULL)
+        return;
+    memcpy(path, match->dir, dir_len);
+    strcpy(path + dir_len, name);
+    if (stat(path, &info) == 0 && S_ISDIR(info.st_mode))
+        le_insert(le, "/", 1);
+    else
+        le_insert(le, " ", 1);
+    MY_FREE(path);
+}
+
+void le_complete(env_t *env_cpy, line_edit_t *le)
+{
+    int start = le_word_start(le);
+    char *word = my_strndup(le->buf + start, le->pos - start);
+    complete_match_t match = {NULL, 0, 0, NULL, 0};
+
+    if (env_cpy->completion == NULL) {
+        MY_FREE(word);
+        return;
+    }
+    if (le_command_word(le, start) && my_strchr(word, '/') == NULL)
+        complete_commands(env_cpy, word, &match);
+    else
+        complete_files(env_cpy, word, &match);
+    if (match.nb == 0)
+        write(1, "\a", 1);
+    else if (match.nb == 1 || complete_common(&match) > match.typed)
+        complete_insert(le, &match);
+    else if (le->tabbed)
+        complete_print(&match);
+    le->tabbed = true;
+    MY_FREE(match.dir);
+    MY_FREE(word);
+}
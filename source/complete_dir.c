@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** complete_dir
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool complete_dir_load(dir_cache_t *cache, char *dir, struct stat *info)
+{
+    glob_scan_t scan = {dir, "", glob_compile("*", 1), false, false,
+        &cache->list};
+
+    glob_list_free(&cache->list);
+    MY_FREE(cache->names);
+    cache->nb_names = 0;
+    if (scan.pat == NULL)
+        return false;
+    scan.pat->dot_ok = true;
+    glob_scan_dir(&scan);
+    glob_free(scan.pat);
+    cache->names = glob_list_strings(&cache->list);
+    if (cache->names == NULL)
+        return false;
+    glob_sort(cache->names, cache->list.nb, 0);
+    cache->nb_names = complete_compact(cache->names, cache->list.nb);
+    cache->dev = info->st_dev;
+    cache->ino = info->st_ino;
+    cache->mtime = info->st_mtim;
+    return true;
+}
+
+dir_cache_t *complete_dir(completion_t *comp, char *dir)
+{
+    struct stat info;
+    dir_cache_t *slot = NULL;
+
+    if (stat(dir, &info) == -1 || !S_ISDIR(info.st_mode))
+        return NULL;
+    for (int i = 0; i < COMPLETE_DIRS && slot == NULL; i++) {
+        if (comp->dirs[i].names != NULL && comp->dirs[i].dev == info.st_dev
+            && comp->dirs[i].ino == info.st_ino)
+            slot = &comp->dirs[i];
+    }
+    if (slot != NULL && slot->mtime.tv_sec == info.st_mtim.tv_sec &&
+        slot->mtime.tv_nsec == info.st_mtim.tv_nsec)
+        return slot;
+    if (slot == NULL) {
+        slot = &comp->dirs[comp->next_dir];
+        comp->next_dir = (comp->next_dir + 1) % COMPLETE_DIRS;
+    }
+    return complete_dir_load(slot, dir, &info) ? slot : NULL;
+}
+
+void complete_files(env_t *env_cpy, char const *word,
+    complete_match_t *match)
+{
+    char const *slash = strrchr(word, '/');
+    int dir_len = (slash == NULL) ? 0 : slash - word + 1;
+    dir_cache_t *cache = NULL;
+
+    match->dir = my_strndup((char *)word, dir_len);
+    if (match->dir == NULL)
+        return;
+    cache = complete_dir(env_cpy->completion,
+        (dir_len == 0) ? "." : match->dir);
+    if (cache == NULL)
+        return;
+    match->names = cache->names;
+    match->typed = my_strlen(word + dir_len);
+    match->nb = complete_range(cache->names, cache->nb_names,
+        word + dir_len, &match->first);
+}
@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** complete_index
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+completion_t *complete_new(void)
+{
+    completion_t *comp = malloc(sizeof(completion_t));
+
+    if (comp == NULL)
+        return NULL;
+    memset(comp, 0, sizeof(completion_t));
+    return comp;
+}
+
+void complete_index_reset(completion_t *comp)
+{
+    glob_list_free(&comp->list);
+    MY_FREE(comp->commands);
+    comp->nb_commands = 0;
+}
+
+/*
+** Names come straight from getdents64: d_type drops directories and the
+** like, leaving one access check per file instead of a stat per entry.
+*/
+void complete_index_build(env_t *env_cpy, completion_t *comp)
+{
+    cmd_cache_t *cache = env_cpy->cmd_cache;
+    char const *builtins[] = {BUILTIN_NAMES};
+    glob_scan_t scan = {NULL, "", glob_compile("*", 1), false, true,
+        &comp->list};
+
+    complete_index_reset(comp);
+    for (size_t i = 0; i < sizeof(builtins) / sizeof(*builtins); i++)
+        glob_list_push(&comp->list, "", builtins[i], my_strlen(builtins[i]));
+    for (int i = 0; scan.pat != NULL && i < cache->nb_dirs; i++) {
+        scan.dir = cache->dirs[i].path;
+        glob_scan_dir(&scan);
+    }
+    glob_free(scan.pat);
+    comp->generation = cache->generation;
+    comp->built = true;
+    comp->commands = glob_list_strings(&comp->list);
+    if (comp->commands == NULL)
+        return;
+    glob_sort(comp->commands, comp->list.nb, 0);
+    comp->nb_commands = complete_compact(comp->commands, comp->list.nb);
+}
+
+void complete_commands(env_t *env_cpy, char const *word,
+    complete_match_t *match)
+{
+    completion_t *comp = env_cpy->completion;
+
+    cmd_cache_sync(env_cpy);
+    if (!comp->built || comp->generation != env_cpy->cmd_cache->generation)
+        complete_index_build(env_cpy, comp);
+    if (comp->commands == NULL)
+        return;
+    match->names = comp->commands;
+    match->typed = my_strlen(word);
+    match->nb = complete_range(comp->commands, comp->nb_commands, word,
+        &match->first);
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** complete_list
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int complete_range(char **names, int nb, char const *prefix, int *first)
+{
+    int len = my_strlen(prefix);
+    int low = 0;
+    int high = nb;
+    int mid = 0;
+    int count = 0;
+
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (strncmp(names[mid], prefix, len) < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    *first = low;
+    while (low + count < nb && strncmp(names[low + count], prefix, len) == 0)
+        count++;
+    return count;
+}
+
+int complete_common(complete_match_t *match)
+{
+    char *first = match->names[match->first];
+    char *last = match->names[match->first + match->nb - 1];
+    int len = 0;
+
+    while (first[len] != '\0' && first[len] == last[len])
+        len++;
+    return len;
+}
+
+int complete_compact(char **names, int nb)
+{
+    int kept = 0;
+
+    for (int i = 0; i < nb; i++) {
+        if (my_strcmp(names[i], ".") == 0 || my_strcmp(names[i], "..") == 0)
+            continue;
+        if (kept > 0 && my_strcmp(names[kept - 1], names[i]) == 0)
+            continue;
+        names[kept++] = names[i];
+    }
+    names[kept] = NULL;
+    return kept;
+}
+
+void complete_put_cell(char const *name, int width, bool last)
+{
+    char const spaces[] = "                                ";
+    int len = my_strlen(name);
+
+    write(1, name, len);
+    if (last) {
+        write(1, "\n", 1);
+        return;
+    }
+    for (int pad = width - len; pad > 0; pad -= 32)
+        write(1, spaces, (pad < 32) ? pad : 32);
+}
+
+void complete_print(complete_match_t *match)
+{
+    char **names = match->names + match->first;
+    struct winsize size;
+    int width = 0;
+    int cols = 1;
+
+    for (int i = 0; i < match->nb; i++)
+        if (my_strlen(names[i]) + 2 > width)
+            width = my_strlen(names[i]) + 2;
+    if (ioctl(1, TIOCGWINSZ, &size) == 0 && size.ws_col > width)
+        cols = size.ws_col / width;
+    write(1, "\n", 1);
+    for (int i = 0; i < match->nb; i++)
+        complete_put_cell(names[i], width,
+            (i + 1) % cols == 0 || i + 1 == match->nb);
+}
@@ -18,12 +18,6 @@
 
 char **create_new_key(env_t *env_cpy, char *new_key)
 {
-    int nb_line_array = count_nb_lines_array(env_cpy->env_copy);
-    int len_new_env = nb_line_array + 1;
-    char **new_env_copy = malloc(sizeof(char *) * (len_new_env + 1));
-
-    new_env_copy = my_strdup_array(env_cpy->env_copy, new_env_copy);
-    new_env_copy[len_new_env - 1] = my_strdup(new_key);
-    new_env_copy[len_new_env] = NULL;
-    return new_env_copy;
+    env_append(env_cpy, my_strdup(new_key));
+    return env_cpy->env_copy;
 }
@@ -14,9 +14,10 @@
 #include <sys/types.h>
 #include <dirent.h>
 
-char *create_path_ez(char *current_dir, char *order)
+char *create_path_ez(strbuf_t *sb, char *current_dir, char *order)
 {
-    char *new_path = str_concat(str_concat(current_dir, "/"), order);
-
-    return new_path;
+    sb_reset(sb);
+    if (sb_append_many(sb, current_dir, "/", order, NULL) != 0)
+        return NULL;
+    return sb->str;
 }
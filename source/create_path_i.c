@@ -14,9 +14,7 @@
 #include <sys/types.h>
 #include <dirent.h>
 
-char *create_path_i(char *current_dir, char **input, int i)
+char *create_path_i(strbuf_t *sb, char *current_dir, char **input, int i)
 {
-    char *new_path = str_concat(str_concat(current_dir, "/"), input[i]);
-
-    return new_path;
+    return create_path_ez(sb, current_dir, input[i]);
 }
@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** deadline
+*/
+
+#define _GNU_SOURCE
+#include <limits.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+long deadline_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/*
+** A nested timeout can only shorten the one already running; 0 leaves the
+** current deadline, if any, untouched.
+*/
+void deadline_arm(deadline_t *deadline, long limit, long grace)
+{
+    long at = deadline_now() + limit;
+
+    if (limit <= 0)
+        return;
+    if (deadline->at == 0 || at < deadline->at)
+        deadline->at = at;
+    deadline->grace = grace;
+    deadline->signals = 0;
+}
+
+/*
+** epoll takes an int, about 24 days: a longer wait is cut to that and the
+** caller's loop simply waits again.
+*/
+int deadline_timeout(deadline_t *deadline)
+{
+    long left = 0;
+
+    if (deadline->at == 0)
+        return -1;
+    left = deadline->at - deadline_now();
+    if (left > INT_MAX)
+        return INT_MAX;
+    return (left < 0) ? 0 : (int)left;
+}
+
+/*
+** SIGTERM first, SIGKILL once the grace period is over too; both go
+** through the pidfd so a recycled pid can never be hit.
+*/
+void deadline_check(deadline_t *deadline, child_t *child)
+{
+    if (deadline->at == 0 || child->done || deadline_now() < deadline->at)
+        return;
+    if (deadline->signals == 0) {
+        syscall(SYS_pidfd_send_signal, child->pidfd, SIGTERM, NULL, 0);
+        deadline->at = deadline_now() + deadline->grace;
+    } else {
+        syscall(SYS_pidfd_send_signal, child->pidfd, SIGKILL, NULL, 0);
+        deadline->at = 0;
+    }
+    deadline->signals++;
+}
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** env_index
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int env_index_probe(env_t *env_cpy, char const *name, int len)
+{
+    env_index_t *index = &env_cpy->env_index;
+    int pos = my_hash_n(name, len) & (index->cap - 1);
+    char *entry = NULL;
+
+    while (index->slots[pos] != -1) {
+        entry = env_cpy->env_copy[index->slots[pos]];
+        if (strncmp(entry, name, len) == 0 && entry[len] == '=')
+            return pos;
+        pos = (pos + 1) & (index->cap - 1);
+    }
+    return pos;
+}
+
+void env_index_add(env_t *env_cpy, int slot)
+{
+    env_index_t *index = &env_cpy->env_index;
+    char *entry = env_cpy->env_copy[slot];
+    int len = getenv_name_len(entry);
+    int pos = 0;
+
+    if (entry[len] != '=')
+        return;
+    pos = env_index_probe(env_cpy, entry, len);
+    if (index->slots[pos] == -1) {
+        index->slots[pos] = slot;
+        index->nb++;
+    }
+}
+
+/*
+** Open addressing on the slot numbers of env_copy, kept at most half
+** full. The first of two entries with the same name wins, as with the
+** linear scan.
+*/
+bool env_index_build(env_t *env_cpy)
+{
+    env_index_t *index = &env_cpy->env_index;
+    int nb = my_array_len(env_cpy->env_copy);
+    int cap = ENV_INDEX_MIN;
+
+    while (cap < nb * 2 + 2)
+        cap *= 2;
+    MY_FREE(index->slots);
+    index->slots = malloc(sizeof(int) * cap);
+    index->valid = index->slots != NULL;
+    if (!index->valid)
+        return false;
+    memset(index->slots, -1, sizeof(int) * cap);
+    index->cap = cap;
+    index->nb = 0;
+    for (int i = 0; i < nb; i++)
+        env_index_add(env_cpy, i);
+    return true;
+}
+
+void env_index_append(env_t *env_cpy, int slot)
+{
+    env_index_t *index = &env_cpy->env_index;
+
+    if (!index->valid)
+        return;
+    if ((index->nb + 2) * 2 > index->cap) {
+        index->valid = false;
+        return;
+    }
+    env_index_add(env_cpy, slot);
+}
+
+void env_index_drop(env_t *env_cpy)
+{
+    env_cpy->env_index.valid = false;
+}
@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** env_overlay
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+char **exec_envp(env_t *env_cpy)
+{
+    return (env_cpy->exec_env != NULL) ? env_cpy->exec_env :
+        env_cpy->env_copy;
+}
+
+int env_assign_count(char **input)
+{
+    int nb = 0;
+    int len = 0;
+
+    for (; input[nb] != NULL; nb++) {
+        len = var_name_len(input[nb]);
+        if (len == 0 || input[nb][len] != '=')
+            break;
+    }
+    return nb;
+}
+
+/*
+** NAME=value replaces or appends a slot, a bare NAME drops it; order is
+** kept so the child sees the same environment the shell would print.
+*/
+int env_overlay_edit(char **envp, int len, char *edit)
+{
+    int name = getenv_name_len(edit);
+    int slot = 0;
+
+    while (slot < len && (my_strncmp(envp[slot], edit, name) != 0 ||
+        envp[slot][name] != '='))
+        slot++;
+    if (edit[name] != '=') {
+        if (slot < len)
+            memmove(envp + slot, envp + slot + 1,
+                sizeof(char *) * (len-- - slot));
+        return len;
+    }
+    envp[slot] = edit;
+    if (slot == len)
+        envp[++len] = NULL;
+    return len;
+}
+
+/*
+** Only the pointer array is new: unchanged slots borrow the current
+** strings and edited ones point into the command words themselves.
+*/
+char **env_overlay(env_t *env_cpy, char **edits, int nb, bool clear)
+{
+    char **base = exec_envp(env_cpy);
+    int len = clear ? 0 : my_array_len(base);
+    char **envp = malloc(sizeof(char *) * (len + nb + 1));
+
+    if (envp == NULL)
+        return NULL;
+    memcpy(envp, base, sizeof(char *) * len);
+    envp[len] = NULL;
+    for (int i = 0; i < nb; i++)
+        len = env_overlay_edit(envp, len, edits[i]);
+    return envp;
+}
+
+/*
+** Runs one command the way every executor does, with any leading
+** NAME=value words applied to the environment it execs with only.
+*/
+void run_argv(char **input, env_t *env_cpy, bool forkable)
+{
+    char **saved = env_cpy->exec_env;
+    char **overlay = NULL;
+    int nb = env_assign_count(input);
+
+    if (nb > 0 && input[nb] != NULL) {
+        overlay = env_overlay(env_cpy, input, nb, false);
+        env_cpy->exec_env = (overlay != NULL) ? overlay : saved;
+        input += nb;
+    }
+    part_one_builtin(input, env_cpy);
+    part_two_builtin(input, env_cpy, forkable);
+    env_cpy->exec_env = saved;
+    MY_FREE(overlay);
+}
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** env_store
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** The kernel lays the inherited strings out back to back, so one address
+** range tells borrowed entries apart from the ones we allocated.
+*/
+void env_borrow(env_t *env_cpy, char **env)
+{
+    int nb = my_array_len(env);
+    char *end = NULL;
+
+    env_cpy->env_lo = NULL;
+    env_cpy->env_hi = NULL;
+    for (int i = 0; i < nb; i++) {
+        end = env[i] + my_strlen(env[i]) + 1;
+        if (env_cpy->env_lo == NULL || env[i] < env_cpy->env_lo)
+            env_cpy->env_lo = env[i];
+        if (end > env_cpy->env_hi)
+            env_cpy->env_hi = end;
+    }
+    env_cpy->env_copy = env_share(env, nb, 0);
+    env_cpy->env_index = (env_index_t){NULL, 0, 0, false};
+}
+
+char **env_share(char **array, int nb, int extra)
+{
+    char **copy = malloc(sizeof(char *) * (nb + extra + 1));
+
+    if (copy == NULL)
+        return NULL;
+    for (int i = 0; i < nb; i++)
+        copy[i] = array[i];
+    copy[nb] = NULL;
+    return copy;
+}
+
+void env_entry_free(env_t *env_cpy, char *entry)
+{
+    if (entry >= env_cpy->env_lo && entry < env_cpy->env_hi)
+        return;
+    free(entry);
+}
+
+void env_entry_set(env_t *env_cpy, int index, char *entry)
+{
+    env_entry_free(env_cpy, env_cpy->env_copy[index]);
+    env_cpy->env_copy[index] = entry;
+}
+
+void env_append(env_t *env_cpy, char *entry)
+{
+    int nb = my_array_len(env_cpy->env_copy);
+    char **copy = env_share(env_cpy->env_copy, nb, 1);
+
+    if (copy == NULL)
+        return;
+    copy[nb] = entry;
+    copy[nb + 1] = NULL;
+    free(env_cpy->env_copy);
+    env_cpy->env_copy = copy;
+    env_index_append(env_cpy, nb);
+}
@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** env_view
+*/
+
+#include "my.h"
+#include "my_minishell.h"
+
+int env_scan(env_t *env_cpy, char const *name, int len)
+{
+    char **env = env_cpy->env_copy;
+    int j = 0;
+
+    for (int i = 0; env[i] != NULL; i++) {
+        j = 0;
+        while (j < len && env[i][j] == name[j])
+            j++;
+        if (j == len && env[i][len] == '=')
+            return i;
+    }
+    return -1;
+}
+
+int env_find(env_t *env_cpy, char const *name, int len)
+{
+    env_index_t *index = &env_cpy->env_index;
+
+    if (!index->valid && !env_index_build(env_cpy))
+        return env_scan(env_cpy, name, len);
+    return index->slots[env_index_probe(env_cpy, name, len)];
+}
+
+/*
+** The value points into the env entry itself: it stays valid until the
+** variable is set or unset again, and may contain '=' of its own.
+*/
+env_view_t env_view(env_t *env_cpy, char const *name)
+{
+    int len = my_strlen(name);
+    int index = env_find(env_cpy, name, len);
+    env_view_t view = {NULL, 0};
+
+    if (index == -1)
+        return view;
+    view.value = env_cpy->env_copy[index] + len + 1;
+    view.len = my_strlen(view.value);
+    return view;
+}
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** event_loop
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool loop_open(event_loop_t *loop)
+{
+    sigset_t mask;
+    struct epoll_event ev = {EPOLLIN, {0}};
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGCHLD);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGWINCH);
+    loop->signal_fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    loop->stdin_added = false;
+    loop->stdin_plain = false;
+    if (loop->signal_fd == -1 || loop->epoll_fd == -1)
+        return false;
+    ev.data.fd = loop->signal_fd;
+    return epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->signal_fd, &ev) == 0;
+}
+
+/*
+** The signals are blocked for good and only ever read from the signalfd;
+** children get the original mask back right before they exec.
+*/
+event_loop_t *loop_new(void)
+{
+    event_loop_t *loop = malloc(sizeof(event_loop_t));
+    sigset_t mask;
+
+    if (loop == NULL)
+        return NULL;
+    memset(loop, 0, sizeof(event_loop_t));
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGCHLD);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGWINCH);
+    sigprocmask(SIG_BLOCK, &mask, &loop->saved_mask);
+    loop->interactive = isatty(STDIN_FILENO);
+    if (!loop_open(loop)) {
+        sigprocmask(SIG_SETMASK, &loop->saved_mask, NULL);
+        MY_FREE(loop);
+    }
+    return loop;
+}
+
+/*
+** A forked shell must not share the parent's epoll instance, and the
+** parent's children and buffered input are none of its business.
+*/
+void loop_child_reset(event_loop_t *loop)
+{
+    child_t *next = NULL;
+
+    if (loop == NULL)
+        return;
+    for (child_t *child = loop->children; child != NULL; child = next) {
+        next = child->next;
+        if (child->pidfd != -1)
+            close(child->pidfd);
+        MY_FREE(child);
+    }
+    loop->children = NULL;
+    close(loop->epoll_fd);
+    close(loop->signal_fd);
+    loop->reader.start = 0;
+    loop->reader.end = 0;
+    loop->deadline = (deadline_t){0, 0, 0};
+    loop_open(loop);
+}
+
+void loop_restore_mask(event_loop_t *loop)
+{
+    if (loop != NULL)
+        sigprocmask(SIG_SETMASK, &loop->saved_mask, NULL);
+}
@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** event_wait
+*/
+
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** SIGCHLD needs no work here: exits arrive on the pidfds and a stop only
+** has to wake whoever waits with WUNTRACED.
+*/
+void loop_signal(env_t *env_cpy)
+{
+    event_loop_t *loop = env_cpy->loop;
+    struct signalfd_siginfo info;
+
+    while (read(loop->signal_fd, &info, sizeof(info)) == sizeof(info)) {
+        if (info.ssi_signo == SIGINT &&
+            (env_cpy->is_child || !loop->interactive)) {
+            loop_restore_mask(loop);
+            raise(SIGINT);
+        }
+        if (info.ssi_signo == SIGINT)
+            loop->interrupted = true;
+        if (info.ssi_signo == SIGWINCH)
+            loop->resized = true;
+    }
+}
+
+int loop_wait(env_t *env_cpy, int timeout)
+{
+    event_loop_t *loop = env_cpy->loop;
+    struct epoll_event events[LOOP_EVENTS];
+    int nb = epoll_wait(loop->epoll_fd, events, LOOP_EVENTS, timeout);
+    int ready = 0;
+    child_t *child = NULL;
+
+    for (int i = 0; i < nb; i++) {
+        if (events[i].data.fd == loop->signal_fd) {
+            loop_signal(env_cpy);
+            continue;
+        }
+        if (events[i].data.fd == STDIN_FILENO) {
+            ready |= LOOP_STDIN;
+            continue;
+        }
+        child = child_find(loop, -1, events[i].data.fd);
+        if (child != NULL)
+            child_reap(loop, child);
+    }
+    return ready;
+}
+
+/*
+** stdin is one-shot so pending input never wakes a wait for a child; a
+** regular file cannot be polled and is simply always ready.
+*/
+bool loop_arm_stdin(event_loop_t *loop)
+{
+    struct epoll_event ev = {EPOLLIN | EPOLLONESHOT, {.fd = STDIN_FILENO}};
+    int op = loop->stdin_added ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+
+    if (loop->stdin_plain)
+        return false;
+    if (epoll_ctl(loop->epoll_fd, op, STDIN_FILENO, &ev) == -1) {
+        loop->stdin_plain = true;
+        return false;
+    }
+    loop->stdin_added = true;
+    return true;
+}
+
+int loop_wait_stdin(env_t *env_cpy)
+{
+    event_loop_t *loop = env_cpy->loop;
+    int ready = 0;
+
+    if (loop == NULL || !loop_arm_stdin(loop))
+        return LOOP_STDIN;
+    loop_signal(env_cpy);
+    loop->interrupted = false;
+    loop->resized = false;
+    while (ready == 0) {
+        ready = loop_wait(env_cpy, -1);
+        ready |= loop->interrupted ? LOOP_INTERRUPT : 0;
+        ready |= loop->resized ? LOOP_RESIZE : 0;
+    }
+    return ready;
+}
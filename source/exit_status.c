@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** exit_status
+*/
+
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int builtin_status(env_t *env_cpy, int ret)
+{
+    env_cpy->last_status = (ret == 0) ? 0 : 1;
+    return ret;
+}
+
+char const *signal_message(int sig)
+{
+    signal_msg_t const messages[] = {SIGNAL_MESSAGES};
+
+    for (size_t i = 0; i < sizeof(messages) / sizeof(*messages); i++) {
+        if (messages[i].sig == sig)
+            return messages[i].message;
+    }
+    return strsignal(sig);
+}
+
+void wait_status(env_t *env_cpy, int status)
+{
+    int sig = 0;
+
+    if (WIFEXITED(status)) {
+        env_cpy->last_status = WEXITSTATUS(status);
+        return;
+    }
+    if (!WIFSIGNALED(status))
+        return;
+    sig = WTERMSIG(status);
+    env_cpy->last_status = 128 + sig;
+    if (sig == SIGINT)
+        return;
+    my_putstr_err((char *)signal_message(sig));
+    if (WCOREDUMP(status))
+        my_putstr_err(" (core dumped)");
+    my_putstr_err("\n");
+}
+
+void exec_failed(env_t *env_cpy, char *name)
+{
+    my_putstr_err(name);
+    if (errno == ENOEXEC)
+        my_putstr_err(": Exec format error. Binary file not executable.\n");
+    else if (errno == E2BIG)
+        my_putstr_err(": Arguments too long.\n");
+    else {
+        my_putstr_err(": ");
+        my_putstr_err(strerror(errno));
+        my_putstr_err(".\n");
+    }
+    mysh_exit(env_cpy, 1);
+}
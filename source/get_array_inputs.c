@@ -20,7 +20,7 @@ char **get_array_inputs(char *buffer)
     char **array = NULL;
     char *clean_str = my_strdup(buffer);
 
-    array = my_split(clean_str, " \t");
+    array = split_top_level(clean_str, " \t");
     MY_FREE(clean_str);
     return array;
 }
@@ -31,21 +31,7 @@ char **get_array_inputs_coma(char *buffer)
     char *clean_str = my_strdup(buffer);
 
     clean_str = rm_last_gtl(clean_str);
-    array = my_split(clean_str, ";");
-    MY_FREE(clean_str);
-    return array;
-}
-
-char **get_array_inputs_pipe(char *buffer)
-{
-    char **array = NULL;
-    char *clean_str = my_strdup(buffer);
-
-    clean_str = turn_sep_to_spaces(clean_str, '\t');
-    clean_str = str_cleaner(clean_str, ' ');
-    clean_str = rm_last_gtl(clean_str);
-    clean_str = rm_trailling_spaces(clean_str);
-    array = my_split(clean_str, "|");
+    array = split_top_level(clean_str, ";");
     MY_FREE(clean_str);
     return array;
 }
@@ -55,11 +41,10 @@ char **get_array_inputs_redirect(char *buffer)
     char **array = NULL;
     char *clean_str = my_strdup(buffer);
 
-    clean_str = turn_sep_to_spaces(clean_str, '\t');
-    clean_str = str_cleaner(clean_str, ' ');
+    clean_str = str_normalize(clean_str, " \t");
     clean_str = rm_last_gtl(clean_str);
     clean_str = rm_trailling_spaces(clean_str);
-    array = my_split(clean_str, ">");
+    array = split_top_level(clean_str, ">");
     MY_FREE(clean_str);
     return array;
 }
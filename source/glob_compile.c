@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** glob_compile
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int glob_class_range(glob_op_t *op, char const *pat)
+{
+    int first = (unsigned char)pat[0];
+    int last = first;
+    int len = 1;
+
+    if (pat[1] == '-' && pat[2] != ']' && pat[2] != '\0') {
+        last = (unsigned char)pat[2];
+        len = 3;
+    }
+    for (int c = first; c <= last; c++)
+        op->set[c >> 3] |= 1 << (c & 7);
+    return len;
+}
+
+int glob_compile_class(glob_op_t *op, char const *pat)
+{
+    int i = 1;
+    bool negate = (pat[1] == '!' || pat[1] == '^');
+
+    op->type = GLOB_CLASS;
+    for (int k = 0; k < 32; k++)
+        op->set[k] = 0;
+    i += negate;
+    do {
+        if (pat[i] == '\0')
+            return -1;
+        i += glob_class_range(op, pat + i);
+    } while (pat[i] != ']');
+    for (int k = 0; negate && k < 32; k++)
+        op->set[k] = ~op->set[k];
+    return i + 1;
+}
+
+int glob_compile_op(glob_op_t *op, char const *pat)
+{
+    int len = 1;
+
+    op->type = GLOB_LITERAL;
+    op->c = pat[0];
+    if (pat[0] == '*')
+        op->type = GLOB_STAR;
+    if (pat[0] == '?')
+        op->type = GLOB_ANY;
+    if (pat[0] == '\\' && pat[1] != '\0') {
+        op->c = pat[1];
+        len = 2;
+    }
+    if (pat[0] == '[') {
+        len = glob_compile_class(op, pat);
+        if (len == -1) {
+            op->type = GLOB_LITERAL;
+            len = 1;
+        }
+    }
+    return len;
+}
+
+glob_pat_t *glob_compile(char const *pat, int len)
+{
+    glob_pat_t *compiled = malloc(sizeof(glob_pat_t));
+    int i = 0;
+
+    if (compiled == NULL)
+        return NULL;
+    compiled->ops = malloc(sizeof(glob_op_t) * (len + 1));
+    compiled->nb_ops = 0;
+    compiled->dot_ok = (pat[0] == '.');
+    while (i < len) {
+        i += glob_compile_op(&compiled->ops[compiled->nb_ops], pat + i);
+        if (compiled->nb_ops > 0 &&
+            compiled->ops[compiled->nb_ops].type == GLOB_STAR &&
+            compiled->ops[compiled->nb_ops - 1].type == GLOB_STAR)
+            continue;
+        compiled->nb_ops++;
+    }
+    return compiled;
+}
+
+void glob_free(glob_pat_t *compiled)
+{
+    MY_FREE(compiled->ops);
+    MY_FREE(compiled);
+}
@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** glob_escape
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void glob_unescape(char *word)
+{
+    int j = 0;
+
+    for (int i = 0; word[i] != '\0'; i++) {
+        if (word[i] == '\\' && word[i + 1] != '\0')
+            i++;
+        word[j++] = word[i];
+    }
+    word[j] = '\0';
+}
+
+char **glob_unescape_words(char **input)
+{
+    for (int i = 0; input[i] != NULL; i++)
+        glob_unescape(input[i]);
+    return input;
+}
+
+/*
+** A trailing '/' keeps only directories: an empty last component makes
+** the real last one a directory level, then appends the '/' on its own.
+** It points at the last terminator so the walk can still write to it.
+*/
+char **glob_dir_comps(char const *word, char **comps)
+{
+    int len = my_array_len(comps);
+    char **dirs = NULL;
+
+    if (len == 0 || word[my_strlen(word) - 1] != '/')
+        return comps;
+    dirs = malloc(sizeof(char *) * (len + 2));
+    if (dirs == NULL)
+        return NULL;
+    for (int i = 0; i < len; i++)
+        dirs[i] = comps[i];
+    dirs[len] = comps[len - 1] + my_strlen(comps[len - 1]);
+    dirs[len + 1] = NULL;
+    return dirs;
+}
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** glob_expand
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void glob_walk(char *prefix, char **comps, glob_list_t *out)
+{
+    glob_list_t level = {0};
+    glob_scan_t scan = {prefix, prefix, NULL, comps[1] != NULL, false,
+        (comps[1] != NULL) ? &level : out};
+
+    if (!glob_has_magic(comps[0])) {
+        glob_unescape(comps[0]);
+        glob_list_push(&level, prefix, comps[0], my_strlen(comps[0]));
+        if (comps[1] != NULL)
+            glob_walk(level.buf, comps + 1, out);
+        else if (access(level.buf, F_OK) == 0)
+            glob_list_push(out, "", level.buf, my_strlen(level.buf));
+        glob_list_free(&level);
+        return;
+    }
+    scan.pat = glob_compile(comps[0], my_strlen(comps[0]));
+    glob_scan_dir(&scan);
+    glob_free(scan.pat);
+    for (int i = 0; comps[1] != NULL && i < level.nb; i++)
+        glob_walk(level.buf + level.offs[i], comps + 1, out);
+    glob_list_free(&level);
+}
+
+char **glob_word(char *word)
+{
+    glob_list_t out = {0};
+    char **comps = my_split(word, "/");
+    char **dirs = glob_dir_comps(word, comps);
+    char **matches = NULL;
+
+    if (comps[0] == NULL || dirs == NULL) {
+        MY_FREE(comps);
+        return NULL;
+    }
+    glob_walk(word[0] == '/' ? "/" : "", dirs, &out);
+    if (dirs != comps)
+        MY_FREE(dirs);
+    MY_FREE(comps);
+    matches = glob_list_strings(&out);
+    if (matches != NULL)
+        glob_sort(matches, out.nb, 0);
+    if (out.nb == 0)
+        glob_list_free(&out);
+    return matches;
+}
+
+char **glob_join(char **input, char ***matches, int total)
+{
+    char **argv = malloc(sizeof(char *) * (total + 1));
+    int k = 0;
+
+    if (argv == NULL)
+        return NULL;
+    for (int i = 0; input[i] != NULL; i++) {
+        if (matches[i] == NULL) {
+            glob_unescape(input[i]);
+            argv[k++] = input[i];
+            continue;
+        }
+        for (int j = 0; matches[i][j] != NULL; j++)
+            argv[k++] = matches[i][j];
+        MY_FREE(matches[i]);
+    }
+    argv[k] = NULL;
+    MY_FREE(matches);
+    return argv;
+}
+
+char **glob_inputs(char **input)
+{
+    int len = my_array_len(input);
+    char ***matches = NULL;
+    int total = 0;
+    bool matched = false;
+
+    if (!glob_any_magic(input))
+        return glob_unescape_words(input);
+    matches = malloc(sizeof(char **) * (len + 1));
+    for (int i = 0; i < len; i++) {
+        matches[i] = glob_has_magic(input[i]) ? glob_word(input[i]) : NULL;
+        total += (matches[i] != NULL) ? my_array_len(matches[i]) : 1;
+        if (matches[i] != NULL && matches[i][0] != NULL)
+            matched = true;
+    }
+    if (!matched) {
+        my_putstr_err(input[0]);
+        my_putstr_err(": No match.\n");
+        return NULL;
+    }
+    return glob_join(input, matches, total);
+}
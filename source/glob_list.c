@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** glob_list
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool glob_list_reserve(glob_list_t *list, size_t len)
+{
+    char *buf = list->buf;
+    size_t *offs = list->offs;
+
+    if (list->len + len > list->cap) {
+        list->cap = (list->cap + len) * 2;
+        buf = realloc(list->buf, list->cap);
+        if (buf == NULL)
+            return false;
+        list->buf = buf;
+    }
+    if (list->nb == list->cap_offs) {
+        list->cap_offs = list->cap_offs * 2 + 16;
+        offs = realloc(list->offs, sizeof(size_t) * list->cap_offs);
+        if (offs == NULL)
+            return false;
+        list->offs = offs;
+    }
+    return true;
+}
+
+bool glob_list_push(glob_list_t *list, char const *prefix,
+    char const *name, size_t name_len)
+{
+    size_t prefix_len = my_strlen(prefix);
+    bool slash = prefix_len > 0 && prefix[prefix_len - 1] != '/';
+
+    if (!glob_list_reserve(list, prefix_len + slash + name_len + 1))
+        return false;
+    list->offs[list->nb] = list->len;
+    list->nb++;
+    memcpy(list->buf + list->len, prefix, prefix_len);
+    list->len += prefix_len;
+    if (slash)
+        list->buf[list->len++] = '/';
+    memcpy(list->buf + list->len, name, name_len);
+    list->len += name_len;
+    list->buf[list->len++] = '\0';
+    return true;
+}
+
+char **glob_list_strings(glob_list_t *list)
+{
+    char **strings = malloc(sizeof(char *) * (list->nb + 1));
+
+    if (strings == NULL)
+        return NULL;
+    for (int i = 0; i < list->nb; i++)
+        strings[i] = list->buf + list->offs[i];
+    strings[list->nb] = NULL;
+    return strings;
+}
+
+void glob_list_free(glob_list_t *list)
+{
+    MY_FREE(list->buf);
+    MY_FREE(list->offs);
+    list->len = 0;
+    list->cap = 0;
+    list->nb = 0;
+    list->cap_offs = 0;
+}
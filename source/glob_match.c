@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** glob_match
+*/
+
+#include "my.h"
+#include "my_minishell.h"
+
+bool glob_op_match(glob_op_t *op, unsigned char c)
+{
+    if (op->type == GLOB_LITERAL)
+        return op->c == (char)c;
+    if (op->type == GLOB_ANY)
+        return true;
+    if (op->type == GLOB_CLASS)
+        return (op->set[c >> 3] >> (c & 7)) & 1;
+    return false;
+}
+
+bool glob_match(glob_pat_t *pat, char const *str)
+{
+    int p = 0;
+    int s = 0;
+    int star_p = -1;
+    int star_s = 0;
+
+    while (str[s] != '\0') {
+        if (p < pat->nb_ops && pat->ops[p].type == GLOB_STAR) {
+            star_p = p++;
+            star_s = s;
+        } else if (p < pat->nb_ops &&
+            glob_op_match(&pat->ops[p], (unsigned char)str[s])) {
+            p++;
+            s++;
+        } else if (star_p != -1) {
+            p = star_p + 1;
+            s = ++star_s;
+        } else
+            return false;
+    }
+    while (p < pat->nb_ops && pat->ops[p].type == GLOB_STAR)
+        p++;
+    return p == pat->nb_ops;
+}
+
+bool glob_has_magic(char const *word)
+{
+    for (int i = 0; word[i] != '\0'; i++) {
+        if (word[i] == '\\' && word[i + 1] != '\0') {
+            i++;
+            continue;
+        }
+        if (word[i] == '*' || word[i] == '?' || word[i] == '[')
+            return true;
+    }
+    return false;
+}
+
+bool glob_any_magic(char **input)
+{
+    for (int i = 0; input[i] != NULL; i++) {
+        if (glob_has_magic(input[i]))
+            return true;
+    }
+    return false;
+}
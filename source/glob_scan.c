@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** glob_scan
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool glob_is_dir(int fd, linux_dirent64_t *entry)
+{
+    struct stat info;
+
+    if (entry->d_type == DT_DIR)
+        return true;
+    if (entry->d_type != DT_UNKNOWN && entry->d_type != DT_LNK)
+        return false;
+    if (fstatat(fd, entry->d_name, &info, 0) == -1)
+        return false;
+    return S_ISDIR(info.st_mode);
+}
+
+bool glob_is_exec(int fd, linux_dirent64_t *entry)
+{
+    struct stat info;
+
+    if (entry->d_type != DT_REG && entry->d_type != DT_LNK &&
+        entry->d_type != DT_UNKNOWN)
+        return false;
+    if (entry->d_type != DT_REG && (fstatat(fd, entry->d_name, &info, 0)
+        == -1 || !S_ISREG(info.st_mode)))
+        return false;
+    return faccessat(fd, entry->d_name, X_OK, 0) == 0;
+}
+
+bool glob_keep(glob_scan_t *scan, int fd, linux_dirent64_t *entry)
+{
+    char *name = entry->d_name;
+
+    if (name[0] == '.' && !scan->pat->dot_ok)
+        return false;
+    if (scan->want_dir && entry->d_type != DT_DIR &&
+        entry->d_type != DT_UNKNOWN && entry->d_type != DT_LNK)
+        return false;
+    if (!glob_match(scan->pat, name))
+        return false;
+    if (scan->want_exec && !glob_is_exec(fd, entry))
+        return false;
+    return !scan->want_dir || glob_is_dir(fd, entry);
+}
+
+int glob_scan_chunk(glob_scan_t *scan, int fd, char *buffer, long len)
+{
+    linux_dirent64_t *entry = NULL;
+
+    for (long pos = 0; pos < len; pos += entry->d_reclen) {
+        entry = (linux_dirent64_t *)(buffer + pos);
+        if (!glob_keep(scan, fd, entry))
+            continue;
+        if (!glob_list_push(scan->out, scan->prefix, entry->d_name,
+            my_strlen(entry->d_name)))
+            return -1;
+    }
+    return 0;
+}
+
+int glob_scan_dir(glob_scan_t *scan)
+{
+    char *dir = (scan->dir[0] == '\0') ? "." : scan->dir;
+    int fd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    char *buffer = NULL;
+    long len = 0;
+
+    if (fd == -1)
+        return -1;
+    buffer = malloc(GLOB_DENTS_BUFFER);
+    if (buffer == NULL) {
+        close(fd);
+        return -1;
+    }
+    while ((len = syscall(SYS_getdents64, fd, buffer,
+        GLOB_DENTS_BUFFER)) > 0) {
+        if (glob_scan_chunk(scan, fd, buffer, len) == -1)
+            break;
+    }
+    MY_FREE(buffer);
+    close(fd);
+    return 0;
+}
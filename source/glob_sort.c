@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** glob_sort
+*/
+
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void glob_swap(char **strs, int a, int b)
+{
+    char *tmp = strs[a];
+
+    strs[a] = strs[b];
+    strs[b] = tmp;
+}
+
+void glob_insertion_sort(char **strs, int nb, int depth)
+{
+    char *tmp = NULL;
+    int j = 0;
+
+    for (int i = 1; i < nb; i++) {
+        tmp = strs[i];
+        for (j = i; j > 0 && strcmp(strs[j - 1] + depth,
+            tmp + depth) > 0; j--)
+            strs[j] = strs[j - 1];
+        strs[j] = tmp;
+    }
+}
+
+void glob_partition(char **strs, int *bounds, int nb, int depth)
+{
+    unsigned char pivot = strs[nb / 2][depth];
+    int lt = 0;
+    int gt = nb - 1;
+    unsigned char c = 0;
+
+    for (int i = 0; i <= gt;) {
+        c = strs[i][depth];
+        if (c < pivot)
+            glob_swap(strs, lt++, i++);
+        else if (c > pivot)
+            glob_swap(strs, i, gt--);
+        else
+            i++;
+    }
+    bounds[0] = lt;
+    bounds[1] = gt + 1;
+}
+
+/*
+** Multikey (three-way radix) quicksort: each level partitions on a
+** single byte, so equal prefixes are never compared twice.
+*/
+void glob_sort(char **strs, int nb, int depth)
+{
+    int bounds[2] = {0};
+
+    while (nb > 1) {
+        if (nb < 16) {
+            glob_insertion_sort(strs, nb, depth);
+            return;
+        }
+        glob_partition(strs, bounds, nb, depth);
+        glob_sort(strs, bounds[0], depth);
+        glob_sort(strs + bounds[1], nb - bounds[1], depth);
+        if (strs[bounds[0]][depth] == '\0')
+            return;
+        strs += bounds[0];
+        nb = bounds[1] - bounds[0];
+        depth++;
+    }
+}
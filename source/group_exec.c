@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** group_exec
+*/
+
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int group_redirect(group_t *group, int *saved)
+{
+    int flags = O_WRONLY | O_CREAT | (group->append ? O_APPEND : O_TRUNC);
+    int fd = 0;
+
+    if (group->file == NULL)
+        return 0;
+    fd = open(group->file, flags | O_CLOEXEC, 0644);
+    if (fd == -1)
+        return redirect_error(group->file);
+    if (saved != NULL)
+        *saved = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+    dup2(fd, STDOUT_FILENO);
+    close(fd);
+    return 0;
+}
+
+int group_input(group_t *group, int *saved)
+{
+    if (group->in == NULL)
+        return 0;
+    if (group->in_fd == -1)
+        group->in_fd = open(group->in, O_RDONLY | O_CLOEXEC);
+    if (group->in_fd == -1)
+        return redirect_error(group->in);
+    if (saved != NULL)
+        *saved = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+    dup2(group->in_fd, STDIN_FILENO);
+    close(group->in_fd);
+    group->in_fd = -1;
+    return 0;
+}
+
+void group_restore(int saved, int fd)
+{
+    if (saved == -1)
+        return;
+    dup2(saved, fd);
+    close(saved);
+}
+
+void group_run(env_t *env_cpy, group_t *group, bool forked)
+{
+    int saved_in = -1;
+    int saved_out = -1;
+
+    if (group_input(group, forked ? NULL : &saved_in) == -1 ||
+        group_redirect(group, forked ? NULL : &saved_out) == -1)
+        env_cpy->last_status = 1;
+    else
+        parse_line(group->body, env_cpy);
+    group_restore(saved_in, STDIN_FILENO);
+    group_restore(saved_out, STDOUT_FILENO);
+}
+
+void run_group(char *command, env_t *env_cpy)
+{
+    group_t group = {NULL, NULL, false, NULL, false, -1};
+    int status = 0;
+    pid_t pid = 0;
+
+    if (group_parse(env_cpy, command, &group) == -1) {
+        env_cpy->last_status = 1;
+    } else if (group_forkless(env_cpy, group.body)) {
+        group_run(env_cpy, &group, false);
+    } else {
+        pid = mysh_fork(env_cpy);
+        if (pid == 0) {
+            group_run(env_cpy, &group, true);
+            mysh_exit(env_cpy, env_cpy->last_status);
+        }
+        if (pid != -1 && mysh_waitpid(env_cpy, pid, &status, 0) != -1)
+            wait_status(env_cpy, status);
+    }
+    group_free(&group);
+}
@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** group_parse
+*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** Reads "> file", ">> file", "< file" or "<< word" at the start of tail
+** and returns how many bytes it used.
+*/
+int group_redirect_word(char *tail, group_t *group)
+{
+    bool in = (tail[0] == '<');
+    bool twice = (tail[1] == tail[0]);
+    int start = 1 + twice + strspn(tail + 1 + twice, " \t");
+    int len = strcspn(tail + start, " \t<>");
+    char **slot = in ? &group->in : &group->file;
+
+    if (*slot != NULL) {
+        my_putstr_err(in ? "Ambiguous input redirect.\n" :
+            "Ambiguous output redirect.\n");
+        return -1;
+    }
+    if (len == 0) {
+        my_putstr_err("Missing name for redirect.\n");
+        return -1;
+    }
+    *slot = my_strndup(tail + start, len);
+    group->here = in ? twice : group->here;
+    group->append = in ? group->append : twice;
+    return start + len;
+}
+
+int group_tail(char *tail, group_t *group)
+{
+    int used = 0;
+
+    tail += strspn(tail, " \t");
+    while (*tail != '\0') {
+        if (*tail != '>' && *tail != '<') {
+            my_putstr_err("Badly placed ()'s.\n");
+            return -1;
+        }
+        used = group_redirect_word(tail, group);
+        if (used == -1)
+            return -1;
+        tail += used;
+        tail += strspn(tail, " \t");
+    }
+    return 0;
+}
+
+/*
+** The lines up to word are read right away, before any fork, and kept in
+** an anonymous file the group then reads as its stdin.
+*/
+int here_doc_open(env_t *env_cpy, char const *word)
+{
+    int fd = memfd_create("mysh-heredoc", MFD_CLOEXEC);
+    char *line = NULL;
+    int len = 0;
+
+    if (fd == -1)
+        return -1;
+    line = read_line(env_cpy);
+    while (line != NULL) {
+        len = strcspn(line, "\n");
+        if (len == my_strlen(word) && strncmp(line, word, len) == 0)
+            break;
+        write(fd, line, my_strlen(line));
+        MY_FREE(line);
+        line = read_line(env_cpy);
+    }
+    MY_FREE(line);
+    lseek(fd, 0, SEEK_SET);
+    return fd;
+}
+
+int group_parse(env_t *env_cpy, char *command, group_t *group)
+{
+    int start = strspn(command, " \t");
+    int end = group_close(command, start);
+
+    if (end == -1)
+        return -1;
+    group->body = my_strndup(command + start + 1, end - start - 1);
+    if (group->body == NULL)
+        return -1;
+    if (logic_is_blank(group->body, my_strlen(group->body))) {
+        my_putstr_err("Invalid null command.\n");
+        return -1;
+    }
+    if (group_tail(command + end + 1, group) == -1)
+        return -1;
+    if (group->here)
+        group->in_fd = here_doc_open(env_cpy, group->in);
+    return (group->here && group->in_fd == -1) ? -1 : 0;
+}
+
+void group_free(group_t *group)
+{
+    MY_FREE(group->body);
+    MY_FREE(group->file);
+    MY_FREE(group->in);
+    if (group->in_fd != -1)
+        close(group->in_fd);
+    group->in_fd = -1;
+}
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** group_scan
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool group_word_safe(env_t *env_cpy, char const *word, int len)
+{
+    char const *builtins[] = {BUILTIN_NAMES};
+    char *name = NULL;
+    bool alias = false;
+
+    for (int i = 0; i < len; i++) {
+        if (word[i] == '$' || word[i] == '`')
+            return false;
+    }
+    for (size_t i = 0; i < sizeof(builtins) / sizeof(*builtins); i++) {
+        if (my_strlen(builtins[i]) == len &&
+            strncmp(builtins[i], word, len) == 0)
+            return false;
+    }
+    name = my_strndup((char *)word, len);
+    alias = name != NULL && alias_find(env_cpy->aliases, name) != NULL;
+    MY_FREE(name);
+    return !alias;
+}
+
+/*
+** Redirect targets and leading NAME=value words are not the command;
+** the first word that is neither must be safe to run in the shell.
+*/
+bool group_word_check(env_t *env_cpy, char const *word, int len,
+    group_scan_t *scan)
+{
+    int name = var_name_len(word);
+
+    if (scan->target) {
+        scan->target = false;
+        return true;
+    }
+    if (!scan->command || (name > 0 && name < len && word[name] == '='))
+        return true;
+    scan->command = false;
+    return group_word_safe(env_cpy, word, len);
+}
+
+/*
+** A body whose command words are all external programs (no builtin,
+** alias or expansion that could turn into one) cannot change the shell
+** state, so the group may run it without forking a subshell first.
+*/
+bool group_forkless(env_t *env_cpy, char const *body)
+{
+    group_scan_t scan = {true, false};
+    int len = 0;
+
+    for (int i = 0; body[i] != '\0'; i += (len > 0) ? len : 1) {
+        len = 0;
+        if (body[i] == '(') {
+            i = group_close(body, i);
+            scan.command = false;
+            if (i == -1)
+                return false;
+        }
+        scan.target |= (body[i] == '<' || body[i] == '>');
+        if (strchr(" \t)<>", body[i]) != NULL)
+            continue;
+        if (strchr(";&|", body[i]) != NULL) {
+            scan.command = true;
+            continue;
+        }
+        len = strcspn(body + i, " \t;&|()<>");
+        if (!group_word_check(env_cpy, body + i, len, &scan))
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** group_split
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int group_close(char const *str, int i)
+{
+    int depth = 0;
+
+    for (; str[i] != '\0'; i++) {
+        if (str[i] == '(')
+            depth++;
+        if (str[i] == ')' && --depth == 0)
+            return i;
+    }
+    return -1;
+}
+
+bool group_balanced(char const *line)
+{
+    int depth = 0;
+
+    for (int i = 0; line[i] != '\0'; i++) {
+        if (line[i] == '`' && subst_end(line, i) == -1) {
+            my_putstr_err("Unmatched `.\n");
+            return false;
+        }
+        if (line[i] == '`')
+            i = subst_end(line, i);
+        depth += (line[i] == '(') - (line[i] == ')');
+        if (depth < 0) {
+            my_putstr_err("Too many )'s.\n");
+            return false;
+        }
+    }
+    if (depth > 0)
+        my_putstr_err("Too many ('s.\n");
+    return depth == 0;
+}
+
+int top_level_next(char const *str, charset_t const *seps)
+{
+    int i = 0;
+    int end = 0;
+
+    for (; str[i] != '\0' && !CHARSET_HAS(seps, str[i]); i++) {
+        end = (str[i] == '(') ? group_close(str, i) : subst_end(str, i);
+        if (end == -1)
+            return my_strlen(str);
+        if (end > 0)
+            i = end;
+    }
+    return i;
+}
+
+/*
+** Kept tokens are non-blank and separated, so a string of n bytes holds at
+** most (n + 1) / 2 of them.
+*/
+char **split_top_level(char *str, char const *sep_chars)
+{
+    charset_t seps = charset_make(sep_chars);
+    int size = my_strlen(str);
+    int len = 0;
+    int k = 0;
+    char **array = malloc(sizeof(char *) * ((size + 1) / 2 + 1) + size + 1);
+    char *dest = NULL;
+
+    if (array == NULL)
+        return NULL;
+    dest = (char *)(array + (size + 1) / 2 + 1);
+    while (*str != '\0') {
+        len = top_level_next(str, &seps);
+        if (!logic_is_blank(str, len)) {
+            array[k++] = dest;
+            dest = pack_token(dest, str, len);
+        }
+        str += len + (str[len] != '\0');
+    }
+    array[k] = NULL;
+    return array;
+}
+
+void parse_line(char *line, env_t *env_cpy)
+{
+    char **array_coma = NULL;
+
+    if (!group_balanced(line)) {
+        env_cpy->last_status = 1;
+        return;
+    }
+    array_coma = get_array_inputs_coma(line);
+    if (array_coma == NULL)
+        return;
+    parse_on_pipe(array_coma, env_cpy);
+    MY_FREE(array_coma);
+}
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** history_add
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool hist_check_magic(history_t *hist)
+{
+    uint64_t expected = 0;
+
+    __atomic_compare_exchange_n(&hist->header->magic, &expected, HIST_MAGIC,
+        false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return hist->header->magic == HIST_MAGIC;
+}
+
+uint64_t *hist_head(history_t *hist, char const *line, int level)
+{
+    unsigned long bucket = my_hash_n(line, level + 1) % HIST_BUCKETS;
+
+    return &hist->header->heads[level][bucket];
+}
+
+void hist_chain(history_t *hist, uint64_t idx, char const *line, int len)
+{
+    hist_link_t *link = &HIST_LINKS(hist)[idx];
+    uint64_t *head = NULL;
+    uint64_t old = 0;
+
+    for (int level = 0; level < HIST_LEVELS && level < len; level++) {
+        head = hist_head(hist, line, level);
+        old = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+        do {
+            link->prev[level] = old;
+        } while (!__atomic_compare_exchange_n(head, &old, idx + 1, false,
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+    }
+}
+
+bool hist_write_text(history_t *hist, char const *line, int len,
+    uint64_t *offset)
+{
+    char *record = malloc(len + 1);
+    ssize_t written = 0;
+
+    if (record == NULL)
+        return false;
+    for (int i = 0; i < len; i++)
+        record[i] = line[i];
+    record[len] = '\n';
+    written = write(hist->text_fd, record, len + 1);
+    MY_FREE(record);
+    if (written != len + 1)
+        return false;
+    *offset = lseek(hist->text_fd, 0, SEEK_CUR) - (len + 1);
+    return true;
+}
+
+void hist_own_push(history_t *hist, uint64_t idx)
+{
+    uint64_t *own = hist->own;
+
+    if (hist->nb_own == hist->cap_own) {
+        own = realloc(hist->own, sizeof(uint64_t) * (hist->cap_own * 2 + 16));
+        if (own == NULL)
+            return;
+        hist->own = own;
+        hist->cap_own = hist->cap_own * 2 + 16;
+    }
+    hist->own[hist->nb_own++] = idx;
+}
+
+/*
+** Every session appends concurrently: the slot is claimed with an atomic
+** counter, the text goes out as one O_APPEND write, and the slot is only
+** linked into the prefix chains once it is complete.
+*/
+void hist_add(history_t *hist, char const *line, int len)
+{
+    uint64_t idx = 0;
+    uint64_t offset = 0;
+    hist_link_t *link = NULL;
+
+    if (hist == NULL || len <= 0)
+        return;
+    idx = __atomic_fetch_add(&hist->header->count, 1, __ATOMIC_ACQ_REL);
+    if (!hist_reserve(hist, idx + 1) ||
+        !hist_write_text(hist, line, len, &offset))
+        return;
+    link = &HIST_LINKS(hist)[idx];
+    link->length = len;
+    link->time = time(NULL);
+    __atomic_store_n(&link->offset, offset + 1, __ATOMIC_RELEASE);
+    hist_chain(hist, idx, line, len);
+    hist_own_push(hist, idx);
+}
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** history_expand
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool hist_append(hist_out_t *out, char const *str, int len)
+{
+    char *buf = NULL;
+
+    if (out->len + len + 1 > out->cap) {
+        out->cap = (out->len + len + 1) * 2;
+        buf = realloc(out->buf, out->cap);
+        if (buf == NULL)
+            return false;
+        out->buf = buf;
+    }
+    for (int i = 0; i < len; i++)
+        out->buf[out->len++] = str[i];
+    out->buf[out->len] = '\0';
+    return true;
+}
+
+int hist_event_len(char const *spec)
+{
+    int len = 0;
+
+    if (spec[0] == '!')
+        return 1;
+    while (spec[len] != '\0' && str_contain_char(HIST_EVENT_END,
+        spec[len]) != 0)
+        len++;
+    return len;
+}
+
+/*
+** !! and !-n count back in this session's own lines; !n and !prefix use
+** the history every session shares, numbered as `history` prints it.
+*/
+int64_t hist_event(history_t *hist, char const *spec, int len)
+{
+    int nb_own = (hist == NULL) ? 0 : hist->nb_own;
+    long nb = 0;
+    int start = (spec[0] == '-') ? 1 : 0;
+
+    if (spec[0] == '!')
+        return hist_own(hist, nb_own);
+    for (int i = start; i < len; i++) {
+        if (spec[i] < '0' || spec[i] > '9')
+            return hist_find_prefix(hist, spec, len);
+        nb = nb * 10 + spec[i] - '0';
+    }
+    if (start == len)
+        return hist_find_prefix(hist, spec, len);
+    if (start == 0)
+        return (nb >= 1) ? nb - 1 : -1;
+    return hist_own(hist, nb_own - nb + 1);
+}
+
+int hist_substitute(history_t *hist, char const *spec, hist_out_t *out)
+{
+    int len = hist_event_len(spec);
+    int64_t idx = (len > 0) ? hist_event(hist, spec, len) : -1;
+    char *text = NULL;
+    int text_len = 0;
+
+    if (len == 0)
+        return hist_append(out, "!", 1) ? 0 : -1;
+    if (idx >= 0)
+        text = hist_text(hist, idx, &text_len);
+    if (text == NULL) {
+        write(2, spec, len);
+        my_putstr_err(": Event not found.\n");
+        return -1;
+    }
+    out->changed = true;
+    return hist_append(out, text, text_len) ? len : -1;
+}
+
+char *hist_expand(env_t *env_cpy, char *line)
+{
+    hist_out_t out = {NULL, 0, 0, false};
+    int used = 0;
+
+    if (str_contain_char(line, '!') != 0)
+        return line;
+    for (int i = 0; line[i] != '\0'; i++) {
+        if (line[i] != '!') {
+            hist_append(&out, line + i, 1);
+            continue;
+        }
+        used = hist_substitute(env_cpy->history, line + i + 1, &out);
+        if (used == -1) {
+            MY_FREE(out.buf);
+            return NULL;
+        }
+        i += used;
+    }
+    if (out.changed)
+        my_putstr(out.buf);
+    return out.buf;
+}
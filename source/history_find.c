@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** history_find
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+uint64_t hist_count(history_t *hist)
+{
+    if (hist == NULL)
+        return 0;
+    return __atomic_load_n(&hist->header->count, __ATOMIC_ACQUIRE);
+}
+
+char *hist_text(history_t *hist, uint64_t idx, int *len)
+{
+    hist_link_t *link = NULL;
+    uint64_t offset = 0;
+
+    if (idx >= hist_count(hist) || !hist_reserve(hist, idx + 1))
+        return NULL;
+    link = &HIST_LINKS(hist)[idx];
+    offset = __atomic_load_n(&link->offset, __ATOMIC_ACQUIRE);
+    if (offset == 0 || !hist_map_text(hist, offset - 1 + link->length))
+        return NULL;
+    *len = link->length;
+    return hist->text + offset - 1;
+}
+
+bool hist_match(char const *text, int len, char const *prefix, int plen)
+{
+    if (len < plen)
+        return false;
+    for (int i = 0; i < plen; i++) {
+        if (text[i] != prefix[i])
+            return false;
+    }
+    return true;
+}
+
+/*
+** Walks the chain of the longest indexed prefix (up to HIST_LEVELS bytes),
+** newest first, so the answer is usually the chain head.
+*/
+int64_t hist_find_prefix(history_t *hist, char const *prefix, int plen)
+{
+    int level = ((plen < HIST_LEVELS) ? plen : HIST_LEVELS) - 1;
+    uint64_t node = 0;
+    char *text = NULL;
+    int len = 0;
+
+    if (hist == NULL || plen <= 0)
+        return -1;
+    node = __atomic_load_n(hist_head(hist, prefix, level), __ATOMIC_ACQUIRE);
+    while (node != 0) {
+        text = hist_text(hist, node - 1, &len);
+        if (text != NULL && hist_match(text, len, prefix, plen))
+            return node - 1;
+        node = HIST_LINKS(hist)[node - 1].prev[level];
+    }
+    return -1;
+}
+
+/*
+** Line nb of this session, so that !! and !-n never pick a line another
+** shell appended to the shared index in between.
+*/
+int64_t hist_own(history_t *hist, long nb)
+{
+    if (hist == NULL || nb < 1 || nb > hist->nb_own)
+        return -1;
+    return hist->own[nb - 1];
+}
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** history_open
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool hist_map_index(history_t *hist, size_t size)
+{
+    void *map = NULL;
+
+    if (posix_fallocate(hist->index_fd, 0, size) != 0)
+        return false;
+    map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+        hist->index_fd, 0);
+    if (map == MAP_FAILED)
+        return false;
+    if (hist->header != NULL)
+        munmap(hist->header, hist->index_size);
+    hist->header = map;
+    hist->index_size = size;
+    return true;
+}
+
+bool hist_reserve(history_t *hist, uint64_t nb_links)
+{
+    struct stat info;
+    size_t needed = sizeof(hist_header_t) + nb_links * sizeof(hist_link_t);
+    size_t size = hist->index_size;
+
+    if (needed <= size)
+        return true;
+    if (fstat(hist->index_fd, &info) == 0 && (size_t)info.st_size > size)
+        size = info.st_size;
+    while (size < needed)
+        size += HIST_GROW * sizeof(hist_link_t);
+    return hist_map_index(hist, size);
+}
+
+bool hist_map_text(history_t *hist, size_t end)
+{
+    struct stat info;
+    void *map = NULL;
+
+    if (end <= hist->text_size)
+        return true;
+    if (fstat(hist->text_fd, &info) == -1 || (size_t)info.st_size < end)
+        return false;
+    map = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, hist->text_fd, 0);
+    if (map == MAP_FAILED)
+        return false;
+    if (hist->text != NULL)
+        munmap(hist->text, hist->text_size);
+    hist->text = map;
+    hist->text_size = info.st_size;
+    return true;
+}
+
+char *hist_path(env_t *env_cpy, char *suffix)
+{
+    env_view_t home = env_view(env_cpy, "HOME");
+
+    if (home.value == NULL)
+        return NULL;
+    return str_concat(str_concat(home.value, "/" HIST_FILE), suffix);
+}
+
+history_t *hist_open(env_t *env_cpy)
+{
+    history_t *hist = malloc(sizeof(history_t));
+    char *text_path = hist_path(env_cpy, "");
+    char *index_path = hist_path(env_cpy, HIST_INDEX_SUFFIX);
+
+    if (hist == NULL || text_path == NULL || index_path == NULL)
+        return NULL;
+    hist->text = NULL;
+    hist->text_size = 0;
+    hist->header = NULL;
+    hist->index_size = 0;
+    hist->own = NULL;
+    hist->nb_own = 0;
+    hist->cap_own = 0;
+    hist->text_fd = open(text_path, O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC,
+        0600);
+    hist->index_fd = open(index_path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (hist->text_fd == -1 || hist->index_fd == -1 ||
+        !hist_reserve(hist, HIST_GROW) || !hist_check_magic(hist)) {
+        close(hist->text_fd);
+        close(hist->index_fd);
+        MY_FREE(hist);
+        return NULL;
+    }
+    return hist;
+}
@@ -0,0 +1,34 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** init_env
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+env_t *init_env(char **env)
+{
+    env_t *env_cpy = malloc(sizeof(env_t));
+
+    if (env_cpy == NULL)
+        return NULL;
+    env_borrow(env_cpy, env);
+    env_cpy->old_pwd = NULL;
+    env_cpy->pwd = NULL;
+    env_cpy->stat_cache = stat_cache_new();
+    env_cpy->cmd_cache = cmd_cache_new();
+    env_cpy->shell_vars = var_table_new();
+    env_cpy->aliases = alias_table_new();
+    env_cpy->line_arena = arena_new();
+    env_cpy->completion = complete_new();
+    env_cpy->last_status = 0;
+    env_cpy->is_child = false;
+    env_cpy->cat_elided = 0;
+    env_cpy->loop = loop_new();
+    env_cpy->exec_env = NULL;
+    env_cpy->history = hist_open(env_cpy);
+    return env_cpy;
+}
@@ -17,9 +17,11 @@
 #include <stdint.h>
 #include <sys/sysmacros.h>
 
-int is_it_file(char *path, struct stat statbuffer)
+int is_it_file(env_t *env_cpy, char *path)
 {
-    if (stat(path, &statbuffer) == -1)
+    struct stat statbuffer;
+
+    if (cached_stat(env_cpy, path, &statbuffer) == -1)
         return 84;
     if ((statbuffer.st_mode & S_IFMT) == S_IFREG)
         return 0;
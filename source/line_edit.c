@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** line_edit
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <termios.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool le_raw_mode(struct termios *saved)
+{
+    struct termios raw;
+
+    if (tcgetattr(0, saved) == -1)
+        return false;
+    raw = *saved;
+    raw.c_lflag &= ~(ICANON | ECHO | ISIG | IEXTEN);
+    raw.c_iflag &= ~(IXON | ICRNL);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    return tcsetattr(0, TCSADRAIN, &raw) != -1;
+}
+
+void le_redraw(line_edit_t *le)
+{
+    char move[32] = "\r\x1b[";
+    int len = 3;
+
+    write(1, "\r" PROMPT, my_strlen(PROMPT) + 1);
+    write(1, le->buf, le->len);
+    write(1, "\x1b[K", 3);
+    len += my_nbr_to_str(my_strlen(PROMPT) + le->pos, move + len);
+    move[len++] = 'C';
+    write(1, move, len);
+}
+
+/*
+** Returns 0 when there is no key yet: a resize only needs a redraw. A
+** SIGINT sent to the shell counts as ^C since ISIG is off in raw mode.
+*/
+int le_next_key(env_t *env_cpy, line_edit_t *le, unsigned char *c)
+{
+    int ready = loop_wait_stdin(env_cpy);
+
+    if (ready & LOOP_INTERRUPT) {
+        *c = LE_KEY_CTRL('C');
+        return 1;
+    }
+    if (!(ready & LOOP_STDIN)) {
+        le_redraw(le);
+        return 0;
+    }
+    return (read(0, c, 1) == 1) ? 1 : -1;
+}
+
+char *line_edit(env_t *env_cpy)
+{
+    line_edit_t le = {NULL, 0, 0, 0, 0, NULL, false};
+    struct termios saved;
+    int status = LE_CONTINUE;
+
+    if (!le_raw_mode(&saved) || !le_reserve(&le, 0))
+        return NULL;
+    le.hist_idx = hist_count(env_cpy->history);
+    le_redraw(&le);
+    while (status == LE_CONTINUE)
+        status = le_key(env_cpy, &le);
+    tcsetattr(0, TCSADRAIN, &saved);
+    write(1, "\n", 1);
+    MY_FREE(le.draft);
+    if (status == LE_EOF) {
+        MY_FREE(le.buf);
+        return NULL;
+    }
+    le.pos = le.len;
+    le_insert(&le, "\n", 1);
+    return le.buf;
+}
+
+char *read_line(env_t *env_cpy)
+{
+    size_t n = 0;
+    char *buffer = NULL;
+    struct termios mode;
+
+    if (isatty(0) && isatty(1) && tcgetattr(0, &mode) == 0)
+        return line_edit(env_cpy);
+    if (isatty(0))
+        my_putstr(PROMPT);
+    if (env_cpy->loop != NULL)
+        return reader_line(env_cpy);
+    if (getline(&buffer, &n, stdin) == -1) {
+        MY_FREE(buffer);
+        return NULL;
+    }
+    return buffer;
+}
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** line_edit_buf
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool le_reserve(line_edit_t *le, int extra)
+{
+    char *buf = NULL;
+    int cap = (le->len + extra + 2) * 2;
+
+    if (le->buf != NULL && le->len + extra + 2 <= le->cap)
+        return true;
+    buf = realloc(le->buf, cap);
+    if (buf == NULL)
+        return false;
+    le->buf = buf;
+    le->cap = cap;
+    le->buf[le->len] = '\0';
+    return true;
+}
+
+void le_insert(line_edit_t *le, char const *str, int len)
+{
+    if (len <= 0 || !le_reserve(le, len))
+        return;
+    memmove(le->buf + le->pos + len, le->buf + le->pos, le->len - le->pos);
+    memcpy(le->buf + le->pos, str, len);
+    le->len += len;
+    le->pos += len;
+    le->buf[le->len] = '\0';
+}
+
+void le_delete(line_edit_t *le, int at, int len)
+{
+    if (at < 0 || len <= 0 || at >= le->len)
+        return;
+    if (at + len > le->len)
+        len = le->len - at;
+    memmove(le->buf + at, le->buf + at + len, le->len - at - len);
+    le->len -= len;
+    if (le->pos > at)
+        le->pos = (le->pos > at + len) ? le->pos - len : at;
+    le->buf[le->len] = '\0';
+}
+
+void le_set_line(line_edit_t *le, char const *str, int len)
+{
+    le->len = 0;
+    le->pos = 0;
+    le->buf[0] = '\0';
+    le_insert(le, str, len);
+}
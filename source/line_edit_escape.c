@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** line_edit_escape
+*/
+
+#include <unistd.h>
+#include <poll.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** The bytes of an escape sequence arrive together, while a lone ESC is
+** followed by nothing: each byte is waited for LE_ESC_TIMEOUT ms at most.
+*/
+int le_read_timed(char *buf, int len)
+{
+    struct pollfd pfd = {0, POLLIN, 0};
+    int got = 0;
+
+    while (got < len && poll(&pfd, 1, LE_ESC_TIMEOUT) == 1) {
+        if (read(0, buf + got, 1) != 1)
+            break;
+        got++;
+    }
+    return got;
+}
+
+void le_escape(env_t *env_cpy, line_edit_t *le)
+{
+    char seq[3] = {0};
+
+    if (le_read_timed(seq, 2) != 2 || (seq[0] != '[' && seq[0] != 'O'))
+        return;
+    if (seq[1] >= '0' && seq[1] <= '9' && le_read_timed(seq + 2, 1) != 1)
+        return;
+    if (seq[1] == 'A' || seq[1] == 'B')
+        le_history(env_cpy, le, (seq[1] == 'A') ? -1 : 1);
+    if (seq[1] == 'C' && le->pos < le->len)
+        le->pos++;
+    if (seq[1] == 'D' && le->pos > 0)
+        le->pos--;
+    if (seq[1] == 'H' || seq[1] == '1' || seq[1] == '7')
+        le->pos = 0;
+    if (seq[1] == 'F' || seq[1] == '4' || seq[1] == '8')
+        le->pos = le->len;
+    if (seq[1] == '3')
+        le_delete(le, le->pos, 1);
+}
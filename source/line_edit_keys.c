@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** line_edit_keys
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void le_history(env_t *env_cpy, line_edit_t *le, int dir)
+{
+    uint64_t count = hist_count(env_cpy->history);
+    char *text = NULL;
+    int len = 0;
+
+    if ((dir < 0 && le->hist_idx == 0) || (dir > 0 && le->hist_idx >= count))
+        return;
+    if (dir < 0 && le->hist_idx >= count) {
+        MY_FREE(le->draft);
+        le->draft = my_strndup(le->buf, le->len);
+    }
+    le->hist_idx += dir;
+    if (le->hist_idx >= count) {
+        le_set_line(le, le->draft, my_strlen(le->draft));
+        return;
+    }
+    text = hist_text(env_cpy->history, le->hist_idx, &len);
+    if (text != NULL)
+        le_set_line(le, text, len);
+}
+
+int le_motion(line_edit_t *le, unsigned char c)
+{
+    if (c == LE_KEY_CTRL('A'))
+        le->pos = 0;
+    if (c == LE_KEY_CTRL('E'))
+        le->pos = le->len;
+    if (c == LE_KEY_CTRL('B') && le->pos > 0)
+        le->pos--;
+    if (c == LE_KEY_CTRL('F') && le->pos < le->len)
+        le->pos++;
+    if (c == LE_KEY_CTRL('K'))
+        le_delete(le, le->pos, le->len - le->pos);
+    if (c == LE_KEY_CTRL('U'))
+        le_delete(le, 0, le->pos);
+    if (c == LE_KEY_CTRL('L'))
+        write(1, "\x1b[H\x1b[2J", 7);
+    return LE_CONTINUE;
+}
+
+int le_control(env_t *env_cpy, line_edit_t *le, unsigned char c)
+{
+    if (c == '\r' || c == '\n')
+        return LE_DONE;
+    if (c == LE_KEY_CTRL('D') && le->len == 0)
+        return LE_EOF;
+    if (c == LE_KEY_CTRL('D'))
+        le_delete(le, le->pos, 1);
+    if (c == LE_KEY_CTRL('C')) {
+        write(1, "^C", 2);
+        le_set_line(le, "", 0);
+        return LE_DONE;
+    }
+    if ((c == 127 || c == LE_KEY_CTRL('H')) && le->pos > 0)
+        le_delete(le, le->pos - 1, 1);
+    if (c == LE_KEY_CTRL('P') || c == LE_KEY_CTRL('N'))
+        le_history(env_cpy, le, (c == LE_KEY_CTRL('P')) ? -1 : 1);
+    if (c == '\t')
+        le_complete(env_cpy, le);
+    if (c == 27)
+        le_escape(env_cpy, le);
+    return le_motion(le, c);
+}
+
+int le_key(env_t *env_cpy, line_edit_t *le)
+{
+    unsigned char c = 0;
+    int status = LE_CONTINUE;
+    int got = le_next_key(env_cpy, le, &c);
+
+    if (got == -1)
+        return LE_EOF;
+    if (got == 0)
+        return LE_CONTINUE;
+    if (c >= 32 && c != 127)
+        le_insert(le, (char *)&c, 1);
+    else
+        status = le_control(env_cpy, le, c);
+    if (c != '\t')
+        le->tabbed = false;
+    if (status == LE_CONTINUE)
+        le_redraw(le);
+    return status;
+}
@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** line_reader
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+char *reader_take(line_reader_t *reader, int len)
+{
+    char *line = malloc(len + 1);
+
+    if (line == NULL)
+        return NULL;
+    memcpy(line, reader->buf + reader->start, len);
+    line[len] = '\0';
+    reader->start += len;
+    return line;
+}
+
+/*
+** Leftover bytes slide to the front before each read, and the buffer only
+** grows when a single line outgrows it.
+*/
+bool reader_room(line_reader_t *reader)
+{
+    char *bigger = NULL;
+
+    if (reader->start > 0)
+        memmove(reader->buf, reader->buf + reader->start,
+            reader->end - reader->start);
+    reader->end -= reader->start;
+    reader->start = 0;
+    if (reader->end < reader->cap)
+        return true;
+    bigger = realloc(reader->buf, reader->cap * 2 + READER_CHUNK);
+    if (bigger == NULL)
+        return false;
+    reader->buf = bigger;
+    reader->cap = reader->cap * 2 + READER_CHUNK;
+    return true;
+}
+
+void reader_fill(env_t *env_cpy)
+{
+    line_reader_t *reader = &env_cpy->loop->reader;
+    ssize_t got = 0;
+
+    if (!reader_room(reader)) {
+        reader->eof = true;
+        return;
+    }
+    if (!(loop_wait_stdin(env_cpy) & LOOP_STDIN)) {
+        if (env_cpy->loop->interrupted)
+            my_putstr("\n" PROMPT);
+        return;
+    }
+    got = read(STDIN_FILENO, reader->buf + reader->end,
+        reader->cap - reader->end);
+    if (got > 0)
+        reader->end += got;
+    else if (got == 0 || errno != EINTR)
+        reader->eof = true;
+}
+
+char *reader_line(env_t *env_cpy)
+{
+    line_reader_t *reader = &env_cpy->loop->reader;
+    char *newline = NULL;
+    int len = 0;
+
+    while (true) {
+        len = reader->end - reader->start;
+        newline = (len == 0) ? NULL :
+            memchr(reader->buf + reader->start, '\n', len);
+        if (newline != NULL)
+            return reader_take(reader, newline - reader->buf -
+                reader->start + 1);
+        if (reader->eof)
+            return (len > 0) ? reader_take(reader, len) : NULL;
+        reader_fill(env_cpy);
+    }
+}
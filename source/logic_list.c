@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** logic_list
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int logic_next_op(char const *str)
+{
+    for (int i = 0; str[i] != '\0'; i++) {
+        if (str[i] == '(' && group_close(str, i) != -1)
+            i = group_close(str, i);
+        if (subst_end(str, i) > 0)
+            i = subst_end(str, i);
+        if ((str[i] == '&' && str[i + 1] == '&') ||
+            (str[i] == '|' && str[i + 1] == '|'))
+            return i;
+    }
+    return -1;
+}
+
+bool logic_is_blank(char const *str, int len)
+{
+    for (int i = 0; i < len; i++) {
+        if (str[i] != ' ' && str[i] != '\t')
+            return false;
+    }
+    return true;
+}
+
+bool logic_valid(char const *segment)
+{
+    int end = logic_next_op(segment);
+
+    if (end == -1)
+        return true;
+    while (end != -1) {
+        if (logic_is_blank(segment, end))
+            return false;
+        segment += end + 2;
+        end = logic_next_op(segment);
+    }
+    return !logic_is_blank(segment, my_strlen(segment));
+}
+
+/*
+** Commands on the skipped side of && or || are never expanded nor
+** forked, and leave $status untouched.
+*/
+void run_logic_list(char *segment, env_t *env_cpy)
+{
+    char op = 0;
+    int end = 0;
+    char *command = NULL;
+
+    if (!logic_valid(segment)) {
+        my_putstr_err("Invalid null command.\n");
+        env_cpy->last_status = 1;
+        return;
+    }
+    while (segment != NULL) {
+        end = logic_next_op(segment);
+        if (op == 0 || (op == '&') == (env_cpy->last_status == 0)) {
+            command = (end == -1) ? my_strdup(segment) :
+                my_strndup(segment, end);
+            core_executor(command, env_cpy);
+            MY_FREE(command);
+        }
+        op = (end == -1) ? 0 : segment[end];
+        segment = (end == -1) ? NULL : segment + end + 2;
+    }
+}
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** alias and unalias builtins
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void my_alias_list(env_t *env_cpy)
+{
+    alias_table_t *table = env_cpy->aliases;
+    char **names = malloc(sizeof(char *) * (table->nb_aliases + 1));
+    alias_entry_t *entry = NULL;
+    int k = 0;
+
+    if (names == NULL)
+        return;
+    for (int i = 0; i < ALIAS_TABLE_SIZE; i++) {
+        for (entry = table->buckets[i]; entry != NULL; entry = entry->next)
+            names[k++] = entry->name;
+    }
+    glob_sort(names, k, 0);
+    for (int i = 0; i < k; i++) {
+        my_putstr(names[i]);
+        my_putstr("\t");
+        my_putstr(alias_find(table, names[i])->text);
+        my_putstr("\n");
+    }
+    MY_FREE(names);
+}
+
+bool alias_too_dangerous(char *builtin, char *name)
+{
+    if (my_strcmp(name, "alias") == 0 || my_strcmp(name, "unalias") == 0) {
+        my_putstr_err(builtin);
+        my_putstr_err(": Too dangerous to alias that.\n");
+        return true;
+    }
+    return false;
+}
+
+int my_alias(char **input, env_t *env_cpy)
+{
+    alias_entry_t *entry = NULL;
+
+    if (input[1] == NULL) {
+        my_alias_list(env_cpy);
+        return 0;
+    }
+    if (input[2] == NULL) {
+        entry = alias_find(env_cpy->aliases, input[1]);
+        if (entry != NULL) {
+            my_putstr(entry->text);
+            my_putstr("\n");
+        }
+        return 0;
+    }
+    if (alias_too_dangerous("alias", input[1]))
+        return 84;
+    alias_set(env_cpy->aliases, input[1], input + 2);
+    return 0;
+}
+
+int my_unalias(char **input, env_t *env_cpy)
+{
+    if (input[1] == NULL) {
+        my_putstr_err("unalias: Too few arguments.\n");
+        return 84;
+    }
+    for (int i = 1; input[i] != NULL; i++)
+        alias_unset(env_cpy->aliases, input[i]);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** batch builtin
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int batch_options(char **input, batch_t *batch, char ***words)
+{
+    int arg = 1;
+
+    while (input[arg] != NULL && input[arg + 1] != NULL) {
+        if (my_strcmp(input[arg], "-P") == 0)
+            batch->jobs = batch_number(input[arg + 1]);
+        else if (my_strcmp(input[arg], "-n") == 0)
+            batch->max_items = batch_number(input[arg + 1]);
+        else if (my_strcmp(input[arg], "-g") != 0)
+            break;
+        if (my_strcmp(input[arg], "-g") == 0) {
+            *words = input + arg + 1;
+            arg = batch_skip_words(input, arg + 1);
+        } else
+            arg += 2;
+    }
+    if (input[arg] == NULL || input[arg][0] == '-') {
+        my_putstr_err("batch: Too few arguments.\n");
+        return -1;
+    }
+    return arg;
+}
+
+bool batch_open(env_t *env_cpy, batch_t *batch, char **cmd)
+{
+    if (batch->jobs < 1 || batch->jobs > BATCH_JOBS_MAX ||
+        batch->max_items < 0) {
+        my_putstr_err("batch: Badly formed number.\n");
+        return false;
+    }
+    batch->cmd = cmd;
+    batch->nb_cmd = my_array_len(cmd);
+    batch->budget = batch_budget(env_cpy, cmd);
+    if (batch->budget < BATCH_READ) {
+        my_putstr_err("batch: Argument list too long.\n");
+        return false;
+    }
+    batch->pids = malloc(sizeof(pid_t) * batch->jobs);
+    return batch->pids != NULL;
+}
+
+void batch_close(batch_t *batch)
+{
+    MY_FREE(batch->argv);
+    MY_FREE(batch->pids);
+    glob_list_free(&batch->items);
+}
+
+/*
+** batch [-P jobs] [-n max] [-g words... --] command [args...]: runs
+** command with as many stdin lines (or -g words, usually a glob) as fit
+** in one execve, or max of them, up to jobs batches at a time. Nothing
+** runs without items.
+*/
+int my_batch(char **input, env_t *env_cpy)
+{
+    batch_t batch = {0};
+    char **words = NULL;
+    int arg = 0;
+    int ret = 84;
+
+    batch.jobs = 1;
+    arg = batch_options(input, &batch, &words);
+    batch.from_stdin = words == NULL;
+    if (arg != -1 && batch_open(env_cpy, &batch, input + arg)) {
+        ret = (words != NULL) ? batch_words(env_cpy, &batch, words) :
+            batch_read(env_cpy, &batch);
+        if (ret == 0)
+            ret = batch_flush(env_cpy, &batch);
+    }
+    while (batch.running > 0)
+        batch_reap(env_cpy, &batch);
+    batch_close(&batch);
+    if (ret != 0)
+        return builtin_status(env_cpy, 84);
+    env_cpy->last_status = batch.failed ? BATCH_STATUS : 0;
+    return env_cpy->last_status;
+}
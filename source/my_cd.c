@@ -17,16 +17,15 @@
 char *cd_alone(char **input, env_t *env_cpy, char *path)
 {
     (void)input;
-    char *home = NULL;
+    env_view_t home = env_view(env_cpy, "HOME");
 
-    home = my_getenv("HOME", env_cpy);
-    path = my_strdup(home);
+    path = my_strndup(home.value, home.len);
     return path;
 }
 
-int cd_not_existing(char **input)
+int cd_not_existing(char **input, env_t *env_cpy)
 {
-    if (access(input[1], F_OK) != 0) {
+    if (cached_access(env_cpy, input[1], F_OK) != 0) {
         my_putstr_err(input[1]);
         my_putstr_err(": No such file or directory.\n");
         return 84;
@@ -34,9 +33,10 @@ int cd_not_existing(char **input)
     return 1;
 }
 
-int cd_on_file(char **input, char *path, struct stat statbuffer)
+int cd_on_file(char **input, char *path, env_t *env_cpy)
 {
-    if ((access(input[1], F_OK) == 0) && (is_it_file(path, statbuffer) == 0)) {
+    if ((cached_access(env_cpy, input[1], F_OK) == 0) &&
+        (is_it_file(env_cpy, path) == 0)) {
         my_putstr_err(input[1]);
         my_putstr_err(": Not a directory.\n");
         return 84;
@@ -44,32 +44,31 @@ int cd_on_file(char **input, char *path, struct stat statbuffer)
     return 1;
 }
 
-int all_cd_stuff(char **input, env_t *env_cpy,
-            char *current_dir, struct stat statbuffer)
+int all_cd_stuff(char **input, env_t *env_cpy, char *current_dir)
 {
+    strbuf_t sb;
     char *path = NULL;
-    struct stat file_info;
-    stat(input[1], &file_info);
+    int status = cd_only(input, env_cpy, current_dir);
 
-    if (cd_only(input, env_cpy, current_dir) == 0)
-        return 0;
-    path = create_path_i(current_dir, input, 1);
+    if (status != 1)
+        return status;
     if (cd_minus(input, env_cpy, current_dir) == 0)
         return 0;
-    if (cd_on_file(input, path, statbuffer) == 84 ||
-        cd_not_existing(input) == 84)
-        return 84;
-    if (cd_on_folder(input, env_cpy, current_dir, statbuffer) == 0)
-        return 0;
-    if (cd_another(path, env_cpy, current_dir, statbuffer) == 0)
-        return 0;
-    return 1;
+    sb_init(&sb);
+    path = create_path_i(&sb, current_dir, input, 1);
+    if (cd_on_file(input, path, env_cpy) == 84 ||
+        cd_not_existing(input, env_cpy) == 84)
+        status = 84;
+    else if (cd_on_folder(input, env_cpy, current_dir) == 0 ||
+        cd_another(path, env_cpy, current_dir) == 0)
+        status = 0;
+    sb_free(&sb);
+    return status;
 }
 
 int my_cd(char **input, env_t *env_cpy)
 {
     char *current_dir = getcwd(NULL, 0);
-    struct stat statbuffer = {};
     size_t size = 0;
     char *buff_old_pwd = NULL;
 
@@ -78,7 +77,7 @@ int my_cd(char **input, env_t *env_cpy)
         my_putstr_err("cd: Too many arguments\n");
         return 84;
     }
-    if (all_cd_stuff(input, env_cpy, current_dir, statbuffer) == 0)
+    if (all_cd_stuff(input, env_cpy, current_dir) == 0)
         return 0;
     return 84;
 }
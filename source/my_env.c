@@ -14,11 +14,70 @@
 #include "my.h"
 #include "my_minishell.h"
 
-int my_env(env_t *env_cpy)
+void env_print(char **envp)
 {
-    for (int i = 0; env_cpy->env_copy[i] != NULL; i++) {
-        my_putstr(env_cpy->env_copy[i]);
+    for (int i = 0; envp[i] != NULL; i++) {
+        my_putstr(envp[i]);
         my_putstr("\n");
     }
-    return 0;
+}
+
+/*
+** Collects -i, -u NAME and NAME=value into edits for env_overlay and
+** returns the index of the command, or -1 on a bad option.
+*/
+int env_options(char **input, char **edits, int *nb, bool *clear)
+{
+    int i = 1;
+
+    for (; input[i] != NULL; i++) {
+        if (my_strcmp(input[i], "-i") == 0) {
+            *clear = true;
+            continue;
+        }
+        if (my_strcmp(input[i], "-u") == 0 && input[i + 1] != NULL) {
+            edits[(*nb)++] = input[++i];
+            continue;
+        }
+        if (input[i][0] == '-' || getenv_name_len(input[i]) ==
+            my_strlen(input[i]))
+            break;
+        edits[(*nb)++] = input[i];
+    }
+    return (input[i] != NULL && input[i][0] == '-') ? -1 : i;
+}
+
+void env_run(env_t *env_cpy, char **input)
+{
+    if (input[0] == NULL) {
+        env_print(exec_envp(env_cpy));
+        builtin_status(env_cpy, 0);
+    } else {
+        run_argv(input, env_cpy, true);
+    }
+}
+
+int my_env(char **input, env_t *env_cpy)
+{
+    char **edits = malloc(sizeof(char *) * (my_array_len(input) + 1));
+    char **saved = env_cpy->exec_env;
+    bool clear = false;
+    int nb = 0;
+    int cmd = (edits == NULL) ? -1 : env_options(input, edits, &nb, &clear);
+
+    if (cmd == -1) {
+        my_putstr_err("env: Invalid option.\n");
+        MY_FREE(edits);
+        return builtin_status(env_cpy, 84);
+    }
+    if (nb > 0 || clear)
+        env_cpy->exec_env = env_overlay(env_cpy, edits, nb, clear);
+    MY_FREE(edits);
+    if (env_cpy->exec_env == NULL)
+        env_cpy->exec_env = saved;
+    env_run(env_cpy, input + cmd);
+    if (env_cpy->exec_env != saved)
+        MY_FREE(env_cpy->exec_env);
+    env_cpy->exec_env = saved;
+    return env_cpy->last_status;
 }
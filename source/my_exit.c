@@ -0,0 +1,30 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** my_exit
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int my_exit(char **input, env_t *env_cpy)
+{
+    int i = (input[1] != NULL && input[1][0] == '-') ? 1 : 0;
+
+    if (input[1] == NULL)
+        mysh_exit(env_cpy, env_cpy->last_status);
+    if (input[2] != NULL || input[1][i] < '0' || input[1][i] > '9') {
+        my_putstr_err("exit: Expression Syntax.\n");
+        return 84;
+    }
+    while (input[1][i] >= '0' && input[1][i] <= '9')
+        i++;
+    if (input[1][i] != '\0') {
+        my_putstr_err("exit: Badly formed number.\n");
+        return 84;
+    }
+    mysh_exit(env_cpy, my_getnbr(input[1]) & 0xff);
+    return 0;
+}
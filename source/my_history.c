@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** history builtin
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int hist_put_clock(char *buf, time_t when)
+{
+    struct tm tm_info;
+
+    localtime_r(&when, &tm_info);
+    buf[0] = '0' + tm_info.tm_hour / 10;
+    buf[1] = '0' + tm_info.tm_hour % 10;
+    buf[2] = ':';
+    buf[3] = '0' + tm_info.tm_min / 10;
+    buf[4] = '0' + tm_info.tm_min % 10;
+    return 5;
+}
+
+void hist_print_entry(history_t *hist, uint64_t idx)
+{
+    char head[48];
+    int pos = 0;
+    int len = 0;
+    char *text = hist_text(hist, idx, &len);
+
+    if (text == NULL)
+        return;
+    for (int pad = 6 - my_nbr_to_str(idx + 1, NULL); pad > 0; pad--)
+        head[pos++] = ' ';
+    pos += my_nbr_to_str(idx + 1, head + pos);
+    head[pos++] = '\t';
+    pos += hist_put_clock(head + pos, HIST_LINKS(hist)[idx].time);
+    head[pos++] = '\t';
+    write(1, head, pos);
+    write(1, text, len);
+    write(1, "\n", 1);
+}
+
+int my_history(char **input, env_t *env_cpy)
+{
+    uint64_t count = hist_count(env_cpy->history);
+    uint64_t start = 0;
+
+    if (input[1] != NULL && my_str_isnum(input[1]) != 0) {
+        my_putstr_err("history: Badly formed number.\n");
+        return 84;
+    }
+    if (input[1] != NULL && (uint64_t)my_getnbr(input[1]) < count)
+        start = count - my_getnbr(input[1]);
+    for (uint64_t i = start; i < count; i++)
+        hist_print_entry(env_cpy->history, i);
+    return 0;
+}
@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** my_memstats
+*/
+
+#include <stdio.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int my_memstats(char **input, env_t *env_cpy)
+{
+    (void)env_cpy;
+    if (input[1] != NULL) {
+        my_putstr_err("memstats: Too many arguments.\n");
+        return 84;
+    }
+    if (!alloc_stats()->enabled) {
+        my_putstr_err("memstats: MYSH_ALLOC_STATS is not set.\n");
+        return 84;
+    }
+    fflush(stdout);
+    alloc_stats_print(1);
+    return 0;
+}
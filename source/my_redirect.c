@@ -43,13 +43,14 @@ int my_redirect(char *order_one, char *order_two, env_t *env_cpy,
 
     if (error_redirect(order_one, order_two, zero_empty) == 84)
         return 84;
-    arr_one = my_split(order_one, " \t");
+    arr_one = build_argv(order_one, env_cpy);
+    if (arr_one == NULL)
+        return 84;
     arr_two = my_split(order_two, " \t");
     fd = dup(STDOUT_FILENO);
     file = open(arr_two[0], O_WRONLY | O_CREAT | O_TRUNC, 0777);
     dup2(file, STDOUT_FILENO);
-    part_one_builtin(arr_one, env_cpy);
-    part_two_builtin(arr_one, env_cpy, true);
+    run_argv(arr_one, env_cpy, true);
     close(file);
     dup2(fd, STDOUT_FILENO);
     return 0;
@@ -65,13 +66,14 @@ int my_double_redirect(char *order_one, char *order_two, env_t *env_cpy,
 
     if (error_redirect(order_one, order_two, zero_empty) == 84)
         return 84;
-    arr_one = my_split(order_one, " \t");
+    arr_one = build_argv(order_one, env_cpy);
+    if (arr_one == NULL)
+        return 84;
     arr_two = my_split(order_two, " \t");
     fd = dup(STDOUT_FILENO);
     file = open(arr_two[0], O_WRONLY | O_CREAT | O_APPEND, 0777);
     dup2(file, STDOUT_FILENO);
-    part_one_builtin(arr_one, env_cpy);
-    part_two_builtin(arr_one, env_cpy, true);
+    run_argv(arr_one, env_cpy, true);
     close(file);
     dup2(fd, STDOUT_FILENO);
     return 0;
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** set and unset builtins
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void my_set_list(env_t *env_cpy)
+{
+    var_table_t *table = env_cpy->shell_vars;
+    char **names = malloc(sizeof(char *) * (table->nb_vars + 1));
+    var_entry_t *entry = NULL;
+    int k = 0;
+
+    if (names == NULL)
+        return;
+    for (int i = 0; i < VAR_TABLE_SIZE; i++) {
+        for (entry = table->buckets[i]; entry != NULL; entry = entry->next)
+            names[k++] = entry->name;
+    }
+    glob_sort(names, k, 0);
+    for (int i = 0; i < k; i++) {
+        my_putstr(names[i]);
+        my_putstr("\t");
+        my_putstr(var_get(table, names[i], my_strlen(names[i])));
+        my_putstr("\n");
+    }
+    MY_FREE(names);
+}
+
+int my_set_assign(env_t *env_cpy, char *name, char *value)
+{
+    if (is_alpha(name[0]) != 0 && name[0] != '_') {
+        my_putstr_err("set: Variable name must begin with a letter.\n");
+        return 84;
+    }
+    if (var_name_len(name) != my_strlen(name)) {
+        my_putstr_err("set: Variable name must contain ");
+        my_putstr_err("alphanumeric characters.\n");
+        return 84;
+    }
+    var_set(env_cpy->shell_vars, name, value);
+    return 0;
+}
+
+int my_set_word(env_t *env_cpy, char **input, int *i)
+{
+    char *word = input[*i];
+    int eq = getenv_name_len(word);
+    char *value = "";
+
+    if (word[eq] == '=') {
+        word = arena_strndup(env_cpy->line_arena, word, eq);
+        value = input[*i] + eq + 1;
+        if (*value == '\0' && input[*i + 1] != NULL)
+            value = input[++(*i)];
+    } else if (input[*i + 1] != NULL && input[*i + 1][0] == '=') {
+        (*i)++;
+        value = input[*i] + 1;
+        if (*value == '\0')
+            value = (input[*i + 1] != NULL) ? input[++(*i)] : "";
+    }
+    return my_set_assign(env_cpy, word, value);
+}
+
+int my_set(char **input, env_t *env_cpy)
+{
+    if (input[1] == NULL) {
+        my_set_list(env_cpy);
+        return 0;
+    }
+    for (int i = 1; input[i] != NULL; i++) {
+        if (my_set_word(env_cpy, input, &i) == 84)
+            return 84;
+    }
+    return 0;
+}
+
+int my_unset(char **input, env_t *env_cpy)
+{
+    if (input[1] == NULL) {
+        my_putstr_err("unset: Too few arguments.\n");
+        return 84;
+    }
+    for (int i = 1; input[i] != NULL; i++)
+        var_unset(env_cpy->shell_vars, input[i]);
+    return 0;
+}
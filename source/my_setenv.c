@@ -18,7 +18,7 @@
 int my_setenv_error_case(char **input, env_t *env_cpy)
 {
     if (input[1] == NULL) {
-        my_env(env_cpy);
+        env_print(env_cpy->env_copy);
         return 84;
     }
     for (int p = 0; input[p] != NULL; p++) {
@@ -55,17 +55,19 @@ int my_setenv(env_t *env_cpy, char **input)
 {
     int index = 0;
     char *new_var = NULL;
+    strbuf_t sb;
 
     if (my_setenv_error_case(input, env_cpy) == 84)
         return 84;
     index = my_getenv_index(input[1], env_cpy);
-    new_var = my_strdup(input[1]);
-    new_var = str_concat(new_var, "=");
-    if (my_array_len(input) > 2)
-        new_var = str_concat(new_var, input[2]);
+    sb_init(&sb);
+    sb_append_many(&sb, input[1], "=", input[2], NULL);
+    new_var = sb_steal(&sb);
+    if (new_var == NULL)
+        return 84;
     if (index == -1)
-        env_cpy->env_copy = append_to_array(env_cpy->env_copy, new_var);
+        env_append(env_cpy, new_var);
     else
-        env_cpy->env_copy[index] = new_var;
+        env_entry_set(env_cpy, index, new_var);
     return 0;
 }
@@ -22,11 +22,12 @@ char **my_strdup_array_keyless(env_t *env_cpy, char **arr_cpy, char *key)
 
     while (env_cpy->env_copy[i] != NULL) {
         if (my_strncmp(env_cpy->env_copy[i], key, my_strlen(key)) == 0) {
+            env_entry_free(env_cpy, env_cpy->env_copy[i]);
             i++;
             j++;
             continue;
         }
-        arr_cpy[i - j] = my_strdup(env_cpy->env_copy[i]);
+        arr_cpy[i - j] = env_cpy->env_copy[i];
         i++;
     }
     arr_cpy[i - j] = NULL;
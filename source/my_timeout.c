@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** timeout builtin
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+long timeout_unit(char const *suffix)
+{
+    char const units[] = "smhd";
+    long const scale[] = {1, 60, 3600, 86400};
+
+    if (suffix[0] == '\0')
+        return 1;
+    for (int i = 0; units[i] != '\0'; i++) {
+        if (suffix[0] == units[i] && suffix[1] == '\0')
+            return scale[i];
+    }
+    return -1;
+}
+
+/*
+** DURATION is seconds with an optional fraction and an s, m, h or d
+** suffix, as for timeout(1); the result is in milliseconds.
+*/
+long timeout_parse(char const *str)
+{
+    long ms = 0;
+    long scale = 1000;
+    long unit = 0;
+    int i = 0;
+
+    if (str == NULL || str[0] < '0' || str[0] > '9')
+        return -1;
+    for (; str[i] >= '0' && str[i] <= '9' && ms < TIMEOUT_MAX; i++)
+        ms = ms * 10 + (str[i] - '0') * 1000;
+    if (str[i] == '.')
+        i++;
+    for (; str[i] >= '0' && str[i] <= '9'; i++) {
+        scale /= 10;
+        ms += (str[i] - '0') * scale;
+    }
+    unit = timeout_unit(str + i);
+    if (unit == -1 || ms >= TIMEOUT_MAX)
+        return -1;
+    return ms * unit;
+}
+
+int timeout_usage(char **input, int arg, long grace)
+{
+    if (input[arg] == NULL || input[arg + 1] == NULL) {
+        my_putstr_err("timeout: Too few arguments.\n");
+        return 84;
+    }
+    if (grace < 0 || timeout_parse(input[arg]) < 0) {
+        my_putstr_err("timeout: Badly formed number.\n");
+        return 84;
+    }
+    return 0;
+}
+
+/*
+** The command goes through the usual executor; only the wait for the
+** child it forks is bounded, so no watcher process is involved.
+*/
+int my_timeout(char **input, env_t *env_cpy)
+{
+    event_loop_t *loop = env_cpy->loop;
+    deadline_t saved = {0, 0, 0};
+    long grace = TIMEOUT_GRACE;
+    int arg = 1;
+
+    if (input[1] != NULL && my_strcmp(input[1], "-k") == 0) {
+        grace = timeout_parse(input[2]);
+        arg = 3;
+    }
+    if (timeout_usage(input, arg, grace) != 0)
+        return builtin_status(env_cpy, 84);
+    if (loop != NULL) {
+        saved = loop->deadline;
+        deadline_arm(&loop->deadline, timeout_parse(input[arg]), grace);
+    }
+    run_argv(input + arg + 1, env_cpy, true);
+    if (loop != NULL)
+        loop->deadline = saved;
+    return env_cpy->last_status;
+}
@@ -36,6 +36,7 @@ int my_unsetenv(env_t *env_cpy, char **input)
             new_env = delete_key(env_cpy, key);
             just_free_copy(env_cpy);
             env_cpy->env_copy = new_env;
+            env_index_drop(env_cpy);
         }
     }
     if (check_key_existence(input[1], env_cpy) == false)
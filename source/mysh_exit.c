@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** mysh_exit
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void print_shell_stats(env_t *env_cpy)
+{
+    stat_cache_t *cache = env_cpy->stat_cache;
+
+    my_putstr_err("stat cache: ");
+    my_put_nbr_fd(cache->lookups, 2);
+    my_putstr_err(" lookups, ");
+    my_put_nbr_fd(cache->syscalls, 2);
+    my_putstr_err(" syscalls, ");
+    my_put_nbr_fd(cache->lookups - cache->syscalls, 2);
+    my_putstr_err(" saved\n");
+    my_putstr_err("pipelines: ");
+    my_put_nbr_fd(env_cpy->cat_elided, 2);
+    my_putstr_err(" cat stages elided\n");
+}
+
+/*
+** Forked children share the stdin offset with the shell: exit() would
+** resync it and make the parent read the same script lines again.
+*/
+void mysh_exit(env_t *env_cpy, int status)
+{
+    if (env_cpy->is_child) {
+        fflush(stdout);
+        _exit(status);
+    }
+    if (my_getenv_index("MYSH_STATS", env_cpy) != -1)
+        print_shell_stats(env_cpy);
+    if (alloc_stats()->enabled)
+        alloc_stats_print(2);
+    exit(status);
+}
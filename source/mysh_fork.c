@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** mysh_fork
+*/
+
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+pid_t mysh_fork(env_t *env_cpy)
+{
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        env_cpy->is_child = true;
+        loop_child_reset(env_cpy->loop);
+    }
+    if (pid > 0)
+        child_track(env_cpy->loop, pid);
+    return pid;
+}
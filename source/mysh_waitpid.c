@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** mysh_waitpid
+*/
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <sys/wait.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool child_stopped(child_t *child, int options)
+{
+    siginfo_t info;
+
+    if (!(options & WUNTRACED) || child->pidfd == -1)
+        return false;
+    memset(&info, 0, sizeof(info));
+    if (waitid(P_PIDFD, child->pidfd, &info, WSTOPPED | WNOHANG) == -1 ||
+        info.si_pid == 0)
+        return false;
+    child->status = child_status(&info);
+    return true;
+}
+
+/*
+** Drop-in for waitpid on a child from mysh_fork: the shell sleeps in the
+** event loop, so signals are served and other children are reaped on the
+** way. A stopped child stays tracked and is reaped once it finally exits.
+*/
+pid_t mysh_waitpid(env_t *env_cpy, pid_t pid, int *status, int options)
+{
+    event_loop_t *loop = env_cpy->loop;
+    child_t *child = child_find(loop, pid, -1);
+
+    if (child == NULL)
+        return waitpid(pid, status, options);
+    while (!child->done && !child_stopped(child, options)) {
+        loop_wait(env_cpy, deadline_timeout(&loop->deadline));
+        deadline_check(&loop->deadline, child);
+    }
+    *status = child->status;
+    if (child->done && loop->deadline.signals > 0)
+        *status = TIMEOUT_STATUS << 8;
+    if (child->done)
+        child_forget(loop, child);
+    else
+        child->detached = true;
+    return pid;
+}
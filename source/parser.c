@@ -15,64 +15,82 @@
 #include "my.h"
 #include "my_minishell.h"
 
-void simple_pipe(char **array_coma, int i, env_t *env_cpy)
+void simple_redirection(char *command, env_t *env_cpy)
 {
-    char **array_pipe = NULL;
+    int zero_empty = 1;
+    char **array_redirect = NULL;
 
-    array_pipe = get_array_inputs_pipe(array_coma[i]);
-    my_pipe(array_pipe[0], array_pipe[1], env_cpy);
-    free_array(array_pipe);
+    if (command[0] == '>')
+        zero_empty = 0;
+    array_redirect = get_array_inputs_redirect(command);
+    if (my_redirect(array_redirect[0], array_redirect[1], env_cpy,
+        zero_empty) == 84)
+        env_cpy->last_status = 1;
+    MY_FREE(array_redirect);
 }
 
-void simple_redirection(char **array_coma, int i, env_t *env_cpy)
+void double_redirection(char *command, env_t *env_cpy)
 {
     int zero_empty = 1;
     char **array_redirect = NULL;
 
-    if (array_coma[i][0] == '>')
+    if (command[0] == '>')
         zero_empty = 0;
-    array_redirect = get_array_inputs_redirect(array_coma[i]);
-    my_redirect(array_redirect[0], array_redirect[1], env_cpy, zero_empty);
-    free_array(array_redirect);
+    array_redirect = get_array_inputs_redirect(command);
+    if (my_double_redirect(array_redirect[0], array_redirect[1], env_cpy,
+        zero_empty) == 84)
+        env_cpy->last_status = 1;
+    MY_FREE(array_redirect);
 }
 
-void double_redirection(char **array_coma, int i, env_t *env_cpy)
+/*
+** A line that fails to expand (undefined variable, no match, alias loop)
+** runs nothing but still fails, as $status then shows.
+*/
+void simple_command(char *command, env_t *env_cpy)
 {
-    int zero_empty = 1;
-    char **array_redirect = NULL;
+    char **input = build_argv(command, env_cpy);
 
-    if (array_coma[i][0] == '>')
-        zero_empty = 0;
-    array_redirect = get_array_inputs_redirect(array_coma[i]);
-    my_double_redirect(array_redirect[0], array_redirect[1], env_cpy,
-        zero_empty);
-    free_array(array_redirect);
+    if (input == NULL) {
+        env_cpy->last_status = 1;
+        return;
+    }
+    run_argv(input, env_cpy, true);
 }
 
-void core_executor(char **array_coma, int i, env_t *env_cpy)
+void core_executor(char *command, env_t *env_cpy)
 {
-    char **input = 0;
+    int redirect = top_level_find(command, ">");
+    int pipe = top_level_find(command, "|");
 
-    if (str_contain_char(array_coma[i], '|') == 0) {
-        simple_pipe(array_coma, i, env_cpy);
+    if (command[strspn(command, " \t")] == '(' && pipe == -1) {
+        run_group(command, env_cpy);
+        return;
+    }
+    if (pipe != -1 || top_level_find(command, "<") != -1) {
+        run_pipeline(command, env_cpy);
+        return;
+    }
+    if (top_level_find(command, "()") != -1) {
+        my_putstr_err("Badly placed ()'s.\n");
+        env_cpy->last_status = 1;
         return;
     }
-    if (db_redirect_in_str(array_coma[i]) == 0) {
-        double_redirection(array_coma, i, env_cpy);
-    } else if (str_contain_char(array_coma[i], '>') == 0) {
-        simple_redirection(array_coma, i, env_cpy);
+    if (redirect != -1 && command[redirect + 1] == '>') {
+        double_redirection(command, env_cpy);
+    } else if (redirect != -1) {
+        simple_redirection(command, env_cpy);
     } else {
-        input = get_array_inputs(array_coma[i]);
-        part_one_builtin(input, env_cpy);
-        part_two_builtin(input, env_cpy, true);
+        simple_command(command, env_cpy);
     }
 }
 
 void parse_on_pipe(char **array_coma, env_t *env_cpy)
 {
     for (int i = 0; array_coma[i] != NULL; i++) {
-        if (my_strlen(array_coma[i]) == 0)
+        if (my_strlen(array_coma[i]) == 0 ||
+            (env_cpy->loop != NULL && env_cpy->loop->interrupted))
             break;
-        core_executor(array_coma, i, env_cpy);
+        run_logic_list(array_coma[i], env_cpy);
     }
 }
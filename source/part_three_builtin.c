@@ -0,0 +1,27 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** part_three_builtin
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int part_three_builtin(char **input, env_t *env_cpy)
+{
+    if (my_strcmp(input[0], "set") == 0)
+        return my_set(input, env_cpy);
+    if (my_strcmp(input[0], "unset") == 0)
+        return my_unset(input, env_cpy);
+    if (my_strcmp(input[0], "alias") == 0)
+        return my_alias(input, env_cpy);
+    if (my_strcmp(input[0], "unalias") == 0)
+        return my_unalias(input, env_cpy);
+    if (my_strcmp(input[0], "history") == 0)
+        return my_history(input, env_cpy);
+    if (my_strcmp(input[0], "memstats") == 0)
+        return my_memstats(input, env_cpy);
+    return -1;
+}
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** path_chdir
+*/
+
+#include <sys/inotify.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool path_wd_shared(cmd_cache_t *cache, int index)
+{
+    for (int i = 0; i < cache->nb_dirs; i++) {
+        if (i != index && cache->dirs[i].wd == cache->dirs[index].wd)
+            return true;
+    }
+    return false;
+}
+
+/*
+** A relative entry such as "." names another directory after a chdir:
+** its watch follows the new directory and whatever it resolved, or
+** failed to resolve, is forgotten.
+*/
+void path_dirs_chdir(cmd_cache_t *cache)
+{
+    int first = -1;
+
+    for (int i = 0; i < cache->nb_dirs; i++) {
+        if (cache->dirs[i].path[0] == '/')
+            continue;
+        if (cache->dirs[i].wd != -1 && !path_wd_shared(cache, i))
+            inotify_rm_watch(cache->inotify_fd, cache->dirs[i].wd);
+        path_watch_add(cache, &cache->dirs[i]);
+        if (first == -1)
+            first = i;
+    }
+    if (first != -1)
+        cmd_cache_drop_from(cache, first);
+}
+
+void cwd_changed(env_t *env_cpy)
+{
+    stat_cache_flush(env_cpy->stat_cache);
+    if (env_cpy->cmd_cache != NULL)
+        path_dirs_chdir(env_cpy->cmd_cache);
+}
@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** path_dir
+*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** Only absolute entries get a held O_PATH fd: a relative one such as "."
+** has to follow the shell's cwd, so it keeps being resolved by name.
+*/
+void path_dir_open(path_dir_t *dir)
+{
+    if (dir->fd != -1)
+        close(dir->fd);
+    dir->fd = -1;
+    if (dir->path[0] == '/')
+        dir->fd = open(dir->path, O_PATH | O_DIRECTORY | O_CLOEXEC);
+}
+
+bool path_dir_has(env_t *env_cpy, path_dir_t *dir, char *name)
+{
+    struct stat info;
+    strbuf_t sb;
+    char *path = NULL;
+    bool found = false;
+
+    if (dir->fd == -1 && dir->path[0] == '/')
+        path_dir_open(dir);
+    if (dir->fd != -1)
+        return fstatat(dir->fd, name, &info, 0) == 0 &&
+            !S_ISDIR(info.st_mode) && faccessat(dir->fd, name, X_OK, 0) == 0;
+    if (dir->path[0] == '/')
+        return false;
+    sb_init(&sb);
+    path = create_path_ez(&sb, dir->path, name);
+    found = path != NULL && cached_access(env_cpy, path, X_OK) == 0 &&
+        is_it_dir(env_cpy, path) == 1;
+    sb_free(&sb);
+    return found;
+}
+
+void path_dirs_free(cmd_cache_t *cache)
+{
+    for (int i = 0; i < cache->nb_dirs; i++) {
+        if (cache->dirs[i].wd != -1)
+            inotify_rm_watch(cache->inotify_fd, cache->dirs[i].wd);
+        if (cache->dirs[i].fd != -1)
+            close(cache->dirs[i].fd);
+        MY_FREE(cache->dirs[i].path);
+    }
+    MY_FREE(cache->dirs);
+    cache->nb_dirs = 0;
+}
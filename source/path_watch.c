@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** path_watch
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void path_watch_add(cmd_cache_t *cache, path_dir_t *dir)
+{
+    struct stat info;
+
+    dir->wd = -1;
+    if (cache->inotify_fd != -1)
+        dir->wd = inotify_add_watch(cache->inotify_fd, dir->path,
+            PATH_WATCH_MASK);
+    dir->mtime.tv_sec = 0;
+    dir->mtime.tv_nsec = 0;
+    if (dir->wd == -1 && stat(dir->path, &info) == 0)
+        dir->mtime = info.st_mtim;
+}
+
+void path_dirs_build(cmd_cache_t *cache, char *path_value)
+{
+    char **tokens = my_split(path_value, ":");
+
+    path_dirs_free(cache);
+    MY_FREE(cache->path_value);
+    cache->path_value = my_strdup(path_value);
+    cache->nb_dirs = my_array_len(tokens);
+    cache->dirs = malloc(sizeof(path_dir_t) * (cache->nb_dirs + 1));
+    for (int i = 0; i < cache->nb_dirs; i++) {
+        cache->dirs[i].path = my_strdup(tokens[i]);
+        cache->dirs[i].fd = -1;
+        path_dir_open(&cache->dirs[i]);
+        path_watch_add(cache, &cache->dirs[i]);
+    }
+    MY_FREE(tokens);
+    cmd_cache_drop_from(cache, 0);
+}
+
+void path_watch_event(cmd_cache_t *cache, struct inotify_event *event)
+{
+    if (event->mask & IN_Q_OVERFLOW) {
+        cmd_cache_drop_from(cache, 0);
+        return;
+    }
+    for (int i = 0; i < cache->nb_dirs; i++) {
+        if (cache->dirs[i].wd != event->wd)
+            continue;
+        if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) {
+            cache->dirs[i].wd = -1;
+            path_dir_open(&cache->dirs[i]);
+            cmd_cache_drop_from(cache, i);
+        } else if (event->len > 0) {
+            cmd_cache_drop_name(cache, event->name);
+        }
+    }
+}
+
+void path_watch_drain(cmd_cache_t *cache)
+{
+    char buffer[PATH_WATCH_BUFFER]
+        __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t len = 0;
+    struct inotify_event *event = NULL;
+
+    if (cache->inotify_fd == -1)
+        return;
+    while ((len = read(cache->inotify_fd, buffer, sizeof(buffer))) > 0) {
+        for (char *ptr = buffer; ptr < buffer + len;
+            ptr += sizeof(struct inotify_event) + event->len) {
+            event = (struct inotify_event *)ptr;
+            path_watch_event(cache, event);
+        }
+    }
+}
+
+void path_dirs_poll(cmd_cache_t *cache)
+{
+    struct stat info = {0};
+    path_dir_t *dir = NULL;
+
+    for (int i = 0; i < cache->nb_dirs; i++) {
+        dir = &cache->dirs[i];
+        if (dir->wd != -1)
+            continue;
+        info.st_mtim.tv_sec = 0;
+        info.st_mtim.tv_nsec = 0;
+        stat(dir->path, &info);
+        if (info.st_mtim.tv_sec != dir->mtime.tv_sec ||
+            info.st_mtim.tv_nsec != dir->mtime.tv_nsec) {
+            dir->mtime = info.st_mtim;
+            path_dir_open(dir);
+            cmd_cache_drop_from(cache, i);
+        }
+    }
+}
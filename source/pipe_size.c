@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** pipe_size
+*/
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+long pipe_size_max(void)
+{
+    char buf[32] = {0};
+    int fd = open(PIPE_SIZE_MAX_FILE, O_RDONLY | O_CLOEXEC);
+    long max = 0;
+
+    if (fd == -1)
+        return 0;
+    if (read(fd, buf, sizeof(buf) - 1) > 0)
+        max = my_getnbr(buf);
+    close(fd);
+    return max;
+}
+
+long pipe_size_parse(char const *value)
+{
+    long size = 0;
+    int i = 0;
+
+    for (; value[i] >= '0' && value[i] <= '9'; i++)
+        size = (size > (1L << 40)) ? size : size * 10 + (value[i] - '0');
+    if (value[i] == 'k' || value[i] == 'K')
+        size <<= 10;
+    if (value[i] == 'm' || value[i] == 'M')
+        size <<= 20;
+    return size;
+}
+
+/*
+** Accepts a byte count with an optional k or m suffix. Anything below the
+** kernel default would only slow pipes down, so it and anything that does
+** not parse leave pipes at that default.
+*/
+long pipe_size_get(env_t *env_cpy)
+{
+    char *value = var_get(env_cpy->shell_vars, PIPE_SIZE_VAR,
+        my_strlen(PIPE_SIZE_VAR));
+    long size = 0;
+    long max = 0;
+
+    if (value == NULL)
+        return 0;
+    size = pipe_size_parse(value);
+    if (size < PIPE_SIZE_MIN)
+        return 0;
+    max = pipe_size_max();
+    if (max > 0 && size > max)
+        size = max;
+    return size;
+}
+
+void pipe_size_apply(int *fd, long size)
+{
+    if (size <= 0 || fd[1] == -1)
+        return;
+    fcntl(fd[1], F_SETPIPE_SZ, (int)size);
+}
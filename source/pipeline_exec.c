@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** pipeline_exec
+*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int redirect_error(char *file)
+{
+    my_putstr_err(file);
+    my_putstr_err(": ");
+    my_putstr_err(strerror(errno));
+    my_putstr_err(".\n");
+    return -1;
+}
+
+int command_open(command_t *cmd)
+{
+    int flags = O_WRONLY | O_CREAT | (cmd->append ? O_APPEND : O_TRUNC);
+    int fd = -1;
+
+    if (cmd->in != NULL && cmd->in_fd == -1)
+        cmd->in_fd = open(cmd->in, O_RDONLY | O_CLOEXEC);
+    if (cmd->in != NULL && cmd->in_fd == -1)
+        return redirect_error(cmd->in);
+    if (cmd->out != NULL) {
+        fd = open(cmd->out, flags | O_CLOEXEC, 0644);
+        if (fd == -1)
+            return redirect_error(cmd->out);
+        dup2(fd, STDOUT_FILENO);
+        close(fd);
+    }
+    if (cmd->in_fd != -1) {
+        dup2(cmd->in_fd, STDIN_FILENO);
+        close(cmd->in_fd);
+        cmd->in_fd = -1;
+    }
+    return 0;
+}
+
+void stage_child(env_t *env_cpy, command_t *cmd, int in, int *fd)
+{
+    if (in != -1) {
+        dup2(in, STDIN_FILENO);
+        close(in);
+    }
+    if (fd[1] != -1) {
+        dup2(fd[1], STDOUT_FILENO);
+        close(fd[1]);
+        close(fd[0]);
+    }
+    if (command_open(cmd) == -1)
+        mysh_exit(env_cpy, 1);
+    if (cmd->group != NULL)
+        parse_line(cmd->group, env_cpy);
+    else
+        run_argv(cmd->argv, env_cpy, false);
+    mysh_exit(env_cpy, env_cpy->last_status);
+}
+
+/*
+** Every pipe end is close-on-exec and the shell drops its copies right
+** after each fork, so a stage only ever holds the two ends it uses.
+*/
+void pipeline_spawn(env_t *env_cpy, pipeline_t *pl, pid_t *pids)
+{
+    int in = -1;
+    int fd[2] = {-1, -1};
+    long size = (pl->nb > 1) ? pipe_size_get(env_cpy) : 0;
+
+    for (int i = 0; i < pl->nb; i++) {
+        fd[0] = -1;
+        fd[1] = -1;
+        if (i < pl->nb - 1 && pipe2(fd, O_CLOEXEC) == -1)
+            break;
+        pipe_size_apply(fd, size);
+        pids[i] = stage_spawn(env_cpy, &pl->cmds[i], in, fd);
+        if (in != -1)
+            close(in);
+        if (fd[1] != -1)
+            close(fd[1]);
+        in = fd[0];
+    }
+    if (in != -1)
+        close(in);
+}
+
+void pipeline_wait(env_t *env_cpy, pipeline_t *pl, pid_t *pids)
+{
+    int status = 0;
+    int nb = pl->nb;
+
+    for (int i = 0; i < nb; i++) {
+        if (pids[i] <= 0)
+            continue;
+        if (mysh_waitpid(env_cpy, pids[i], &status, 0) != -1 && i == nb - 1)
+            wait_status(env_cpy, status);
+    }
+    if (pids[nb - 1] <= 0 && !pl->cmds[nb - 1].here)
+        env_cpy->last_status = 1;
+}
@@ -0,0 +1,27 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** pipeline_group
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** A "( list )" stage keeps its body for the forked child to parse, and
+** its redirections land in the fields a plain command uses.
+*/
+int command_group(char *stage, command_t *cmd, env_t *env_cpy)
+{
+    group_t group = {NULL, NULL, false, NULL, false, -1};
+    int status = group_parse(env_cpy, stage, &group);
+
+    cmd->group = group.body;
+    cmd->out = group.file;
+    cmd->append = group.append;
+    cmd->in = group.in;
+    cmd->in_fd = group.in_fd;
+    return status;
+}
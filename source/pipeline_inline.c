@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** pipeline_inline
+*/
+
+#include <signal.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** Only builtins that print without touching shell state may run in the
+** shell; cd, setenv, set NAME=... and friends stay isolated in a child.
+*/
+bool pipeline_inline(command_t *cmd)
+{
+    char **argv = cmd->argv;
+
+    if (argv == NULL || argv[0] == NULL)
+        return false;
+    if (my_strcmp(argv[0], "history") == 0 ||
+        my_strcmp(argv[0], "memstats") == 0)
+        return true;
+    if (my_strcmp(argv[0], "alias") == 0)
+        return argv[1] == NULL || argv[2] == NULL;
+    return argv[1] == NULL && (my_strcmp(argv[0], "env") == 0 ||
+        my_strcmp(argv[0], "set") == 0);
+}
+
+pid_t stage_spawn(env_t *env_cpy, command_t *cmd, int in, int *fd)
+{
+    pid_t pid = 0;
+
+    if (!pipeline_inline(cmd)) {
+        pid = mysh_fork(env_cpy);
+        if (pid == 0)
+            stage_child(env_cpy, cmd, in, fd);
+        return pid;
+    }
+    cmd->here = true;
+    cmd->out_fd = fd[1];
+    fd[1] = -1;
+    return pid;
+}
+
+/*
+** Runs once every other stage is forked: an inline builtin's reader is
+** either alive or already closed, so the shell can never block on a full
+** pipe. SIGPIPE is ignored meanwhile and a dead reader only fails write.
+*/
+void pipeline_run_inline(env_t *env_cpy, pipeline_t *pl)
+{
+    struct sigaction ignore = {.sa_handler = SIG_IGN};
+    struct sigaction old;
+    int status = env_cpy->last_status;
+
+    sigaction(SIGPIPE, &ignore, &old);
+    for (int i = 0; i < pl->nb; i++) {
+        if (!pl->cmds[i].here)
+            continue;
+        command_run_here(env_cpy, &pl->cmds[i]);
+        if (pl->cmds[i].out_fd != -1)
+            close(pl->cmds[i].out_fd);
+        pl->cmds[i].out_fd = -1;
+        if (i == pl->nb - 1)
+            status = env_cpy->last_status;
+    }
+    sigaction(SIGPIPE, &old, NULL);
+    env_cpy->last_status = status;
+}
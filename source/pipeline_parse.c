@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** pipeline_parse
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** Cuts "<file", ">file" or ">>file" found at text[at] out of the command
+** text, blanking it, and returns the file name.
+*/
+char *redirect_word(char *text, int at)
+{
+    int op = 1 + (text[at] == '>' && text[at + 1] == '>');
+    int start = at + op + strspn(text + at + op, " \t");
+    int len = strcspn(text + start, " \t<>|");
+    char *word = NULL;
+
+    if (len == 0) {
+        my_putstr_err("Missing name for redirect.\n");
+        return NULL;
+    }
+    word = my_strndup(text + start, len);
+    memset(text + at, ' ', start + len - at);
+    return word;
+}
+
+int command_redirect(char *text, command_t *cmd)
+{
+    int at = top_level_find(text, "<>");
+    char **slot = NULL;
+
+    while (at != -1) {
+        slot = (text[at] == '<') ? &cmd->in : &cmd->out;
+        if (*slot != NULL) {
+            my_putstr_err(text[at] == '<' ? "Ambiguous input redirect.\n" :
+                "Ambiguous output redirect.\n");
+            return -1;
+        }
+        if (text[at] == '>')
+            cmd->append = (text[at + 1] == '>');
+        *slot = redirect_word(text, at);
+        if (*slot == NULL)
+            return -1;
+        at = top_level_find(text, "<>");
+    }
+    return 0;
+}
+
+int command_parse(char *stage, command_t *cmd, env_t *env_cpy)
+{
+    if (stage[strspn(stage, " \t")] == '(')
+        return command_group(stage, cmd, env_cpy);
+    if (command_redirect(stage, cmd) == -1)
+        return -1;
+    if (top_level_find(stage, "()") != -1) {
+        my_putstr_err("Badly placed ()'s.\n");
+        return -1;
+    }
+    if (logic_is_blank(stage, my_strlen(stage))) {
+        my_putstr_err("Invalid null command.\n");
+        return -1;
+    }
+    cmd->argv = build_argv(stage, env_cpy);
+    return (cmd->argv == NULL || cmd->argv[0] == NULL) ? -1 : 0;
+}
+
+int pipeline_count(char *line)
+{
+    charset_t bar = charset_make("|");
+    int nb = 1;
+    int len = 0;
+
+    for (int i = 0; line[i] != '\0'; i += len + (line[i + len] != '\0')) {
+        len = top_level_next(line + i, &bar);
+        nb += (line[i + len] == '|');
+    }
+    return nb;
+}
+
+int pipeline_parse(char *line, pipeline_t *pl, env_t *env_cpy)
+{
+    charset_t bar = charset_make("|");
+    int len = 0;
+    int status = 0;
+    char *stage = NULL;
+
+    pl->nb = pipeline_count(line);
+    pl->cmds = malloc(sizeof(command_t) * pl->nb);
+    if (pl->cmds == NULL)
+        return -1;
+    for (int i = 0; i < pl->nb; i++)
+        pl->cmds[i] = (command_t){.in_fd = -1, .out_fd = -1};
+    for (int i = 0; i < pl->nb && status == 0; i++) {
+        len = top_level_next(line, &bar);
+        stage = my_strndup(line, len);
+        status = (stage == NULL) ? -1 :
+            command_parse(stage, &pl->cmds[i], env_cpy);
+        MY_FREE(stage);
+        line += len + (line[len] != '\0');
+    }
+    return (status == 0) ? pipeline_check(pl) : -1;
+}
@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** pipeline_pass
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int pipeline_check(pipeline_t *pl)
+{
+    for (int i = 0; i < pl->nb; i++) {
+        if (i > 0 && (pl->cmds[i].in != NULL)) {
+            my_putstr_err("Ambiguous input redirect.\n");
+            return -1;
+        }
+        if (i < pl->nb - 1 && pl->cmds[i].out != NULL) {
+            my_putstr_err("Ambiguous output redirect.\n");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+bool pipeline_cat_shape(command_t *cat, command_t *next)
+{
+    if (cat->argv == NULL || my_array_len(cat->argv) != 2 ||
+        my_strcmp(cat->argv[0], "cat") != 0)
+        return false;
+    if (cat->argv[1][0] == '-' || cat->argv[1][0] == '\0')
+        return false;
+    return cat->in == NULL && cat->out == NULL && next->in == NULL &&
+        next->group == NULL;
+}
+
+/*
+** Only a regular file that opens fine reads the same through "<" as
+** through cat: anything else keeps cat and its error messages.
+*/
+int pipeline_cat_fd(env_t *env_cpy, command_t *cat, command_t *next)
+{
+    struct stat info;
+    int fd = -1;
+
+    if (!pipeline_cat_shape(cat, next) || cmd_locate(env_cpy, "cat") == -1)
+        return -1;
+    fd = open(cat->argv[1], O_RDONLY | O_CLOEXEC);
+    if (fd != -1 && (fstat(fd, &info) == -1 || !S_ISREG(info.st_mode))) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+void pipeline_elide_cat(env_t *env_cpy, pipeline_t *pl)
+{
+    int fd = -1;
+
+    if (pl->nb < 2 || var_get(env_cpy->shell_vars, PIPE_NOCATOPT,
+        my_strlen(PIPE_NOCATOPT)) != NULL)
+        return;
+    fd = pipeline_cat_fd(env_cpy, &pl->cmds[0], &pl->cmds[1]);
+    if (fd == -1)
+        return;
+    pl->cmds[1].in_fd = fd;
+    memmove(pl->cmds, pl->cmds + 1, sizeof(command_t) * (pl->nb - 1));
+    pl->nb--;
+    env_cpy->cat_elided++;
+}
+
+void pipeline_free(pipeline_t *pl)
+{
+    for (int i = 0; pl->cmds != NULL && i < pl->nb; i++) {
+        MY_FREE(pl->cmds[i].in);
+        MY_FREE(pl->cmds[i].out);
+        MY_FREE(pl->cmds[i].group);
+        if (pl->cmds[i].in_fd != -1)
+            close(pl->cmds[i].in_fd);
+        if (pl->cmds[i].out_fd != -1)
+            close(pl->cmds[i].out_fd);
+    }
+    MY_FREE(pl->cmds);
+}
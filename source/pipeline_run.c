@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** pipeline_run
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+/*
+** A lone command with "<", or an inline builtin stage, runs in the shell
+** itself on borrowed stdin/stdout, like the ">" path does.
+*/
+void command_run_here(env_t *env_cpy, command_t *cmd)
+{
+    int saved_in = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+    int saved_out = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+
+    fflush(stdout);
+    if (cmd->out_fd != -1)
+        dup2(cmd->out_fd, STDOUT_FILENO);
+    if (command_open(cmd) == 0) {
+        run_argv(cmd->argv, env_cpy, true);
+    } else {
+        env_cpy->last_status = 1;
+    }
+    fflush(stdout);
+    dup2(saved_in, STDIN_FILENO);
+    dup2(saved_out, STDOUT_FILENO);
+    close(saved_in);
+    close(saved_out);
+}
+
+void run_pipeline(char *command, env_t *env_cpy)
+{
+    pipeline_t pl = {NULL, 0};
+    pid_t *pids = NULL;
+
+    if (pipeline_parse(command, &pl, env_cpy) == -1) {
+        env_cpy->last_status = 1;
+        pipeline_free(&pl);
+        return;
+    }
+    pipeline_elide_cat(env_cpy, &pl);
+    if (pl.nb == 1) {
+        command_run_here(env_cpy, &pl.cmds[0]);
+    } else {
+        pids = calloc(pl.nb, sizeof(pid_t));
+        if (pids != NULL) {
+            pipeline_spawn(env_cpy, &pl, pids);
+            pipeline_run_inline(env_cpy, &pl);
+            pipeline_wait(env_cpy, &pl, pids);
+        }
+        MY_FREE(pids);
+    }
+    pipeline_free(&pl);
+}
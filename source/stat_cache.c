@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** stat_cache
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "my.h"
+#include "my_minishell.h"
+
+stat_entry_t *stat_cache_entry(stat_cache_t *cache, char *path)
+{
+    stat_entry_t *entry = NULL;
+
+    for (int i = 0; i < cache->nb_entries; i++) {
+        if (my_strcmp(cache->entries[i].path, path) == 0)
+            return &cache->entries[i];
+    }
+    if (cache->nb_entries == STAT_CACHE_SIZE)
+        stat_cache_flush(cache);
+    entry = &cache->entries[cache->nb_entries];
+    entry->path = my_strdup(path);
+    entry->stat_ret = STAT_UNKNOWN;
+    for (int i = 0; i < ACCESS_MODES; i++)
+        entry->access_ret[i] = STAT_UNKNOWN;
+    cache->nb_entries++;
+    return entry;
+}
+
+int cached_stat(env_t *env_cpy, char *path, struct stat *buf)
+{
+    stat_cache_t *cache = env_cpy->stat_cache;
+    stat_entry_t *entry = stat_cache_entry(cache, path);
+
+    cache->lookups++;
+    if (entry->stat_ret == STAT_UNKNOWN) {
+        entry->stat_ret = stat(path, &entry->info);
+        cache->syscalls++;
+    }
+    if (buf != NULL)
+        *buf = entry->info;
+    return entry->stat_ret;
+}
+
+int cached_access(env_t *env_cpy, char *path, int mode)
+{
+    stat_cache_t *cache = env_cpy->stat_cache;
+    stat_entry_t *entry = stat_cache_entry(cache, path);
+
+    cache->lookups++;
+    if (entry->access_ret[mode] == STAT_UNKNOWN) {
+        entry->access_ret[mode] = access(path, mode);
+        cache->syscalls++;
+    }
+    return entry->access_ret[mode];
+}
+
+void stat_cache_flush(stat_cache_t *cache)
+{
+    for (int i = 0; i < cache->nb_entries; i++)
+        MY_FREE(cache->entries[i].path);
+    cache->nb_entries = 0;
+}
+
+stat_cache_t *stat_cache_new(void)
+{
+    stat_cache_t *cache = malloc(sizeof(stat_cache_t));
+
+    if (cache == NULL)
+        return NULL;
+    cache->nb_entries = 0;
+    cache->lookups = 0;
+    cache->syscalls = 0;
+    return cache;
+}
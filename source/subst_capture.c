@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** subst_capture
+*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/wait.h>
+#include "my.h"
+#include "my_minishell.h"
+
+void subst_child(env_t *env_cpy, char const *body, int len, int *fd)
+{
+    char *line = my_strndup((char *)body, len);
+
+    close(fd[0]);
+    dup2(fd[1], STDOUT_FILENO);
+    close(fd[1]);
+    if (line != NULL)
+        parse_line(line, env_cpy);
+    mysh_exit(env_cpy, env_cpy->last_status);
+}
+
+int subst_read(arena_t *arena, int fd, subst_out_t *out)
+{
+    arena_map_t *map = arena_map_new(arena, SUBST_BUFFER_SIZE);
+    ssize_t got = 0;
+
+    out->len = 0;
+    if (map == NULL)
+        return -1;
+    while (1) {
+        got = read(fd, map->data + out->len, map->size - out->len - 1);
+        if (got == -1 && errno == EINTR)
+            continue;
+        if (got <= 0)
+            break;
+        out->len += got;
+        if (out->len + 1 == map->size && !arena_map_grow(map, map->size * 2))
+            return -1;
+    }
+    map->data[out->len] = '\0';
+    out->data = map->data;
+    return 0;
+}
+
+/*
+** The pipe is enlarged so the child rarely blocks on a full pipe before
+** the shell gets scheduled to drain it.
+*/
+int subst_capture(env_t *env_cpy, char const *body, int len,
+    subst_out_t *out)
+{
+    int fd[2];
+    int status = 0;
+    int ret = 0;
+    pid_t pid = 0;
+
+    if (pipe2(fd, O_CLOEXEC) == -1)
+        return -1;
+    fcntl(fd[0], F_SETPIPE_SZ, SUBST_PIPE_SIZE);
+    pid = mysh_fork(env_cpy);
+    if (pid == 0)
+        subst_child(env_cpy, body, len, fd);
+    close(fd[1]);
+    ret = (pid == -1) ? -1 : subst_read(env_cpy->line_arena, fd[0], out);
+    close(fd[0]);
+    if (pid != -1 && mysh_waitpid(env_cpy, pid, &status, 0) != -1)
+        wait_status(env_cpy, status);
+    return ret;
+}
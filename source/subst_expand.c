@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** subst_expand
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int subst_literal(env_t *env_cpy, char *word, int i, subst_ctx_t *ctx)
+{
+    int next = subst_next(word, i);
+    char *part = arena_strndup(env_cpy->line_arena, word + i, next - i);
+
+    if (part == NULL || !subst_join(env_cpy->line_arena, &ctx->pend, part,
+        next - i))
+        return -1;
+    return next;
+}
+
+int subst_word(env_t *env_cpy, char *word, subst_ctx_t *ctx)
+{
+    int end = 0;
+    int skip = 0;
+
+    ctx->pend.str = NULL;
+    ctx->pend.len = 0;
+    for (int i = 0; word[i] != '\0'; i = end + 1) {
+        end = subst_end(word, i);
+        if (end == 0) {
+            end = subst_literal(env_cpy, word, i, ctx) - 1;
+            continue;
+        }
+        skip = (word[i] == '$') ? 2 : 1;
+        if (end == -1 || subst_fields(env_cpy, word + i + skip,
+            end - i - skip, ctx) == -1)
+            return -1;
+    }
+    if (ctx->pend.str != NULL && !word_vec_push(&ctx->vec, ctx->pend.str))
+        return -1;
+    return 0;
+}
+
+char **subst_inputs(char **input, env_t *env_cpy)
+{
+    subst_ctx_t ctx = {{NULL, 0, 0}, {NULL, 0}};
+
+    if (!subst_any(input))
+        return input;
+    for (int i = 0; input[i] != NULL; i++) {
+        if (input[i][subst_next(input[i], 0)] == '\0') {
+            word_vec_push(&ctx.vec, input[i]);
+            continue;
+        }
+        if (subst_word(env_cpy, input[i], &ctx) == -1) {
+            MY_FREE(ctx.vec.words);
+            return NULL;
+        }
+    }
+    if (!word_vec_push(&ctx.vec, NULL) || ctx.vec.words[0] == NULL) {
+        MY_FREE(ctx.vec.words);
+        return NULL;
+    }
+    return ctx.vec.words;
+}
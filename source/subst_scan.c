@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** subst_scan
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int subst_end(char const *str, int i)
+{
+    char const *close = NULL;
+
+    if (str[i] == '`') {
+        close = strchr(str + i + 1, '`');
+        return (close == NULL) ? -1 : close - str;
+    }
+    if (str[i] == '$' && str[i + 1] == '(')
+        return group_close(str, i + 1);
+    return 0;
+}
+
+int subst_next(char const *str, int i)
+{
+    for (; str[i] != '\0'; i++) {
+        if (subst_end(str, i) != 0)
+            return i;
+    }
+    return i;
+}
+
+int top_level_find(char const *str, char const *set)
+{
+    int end = 0;
+
+    for (int i = 0; str[i] != '\0'; i++) {
+        end = subst_end(str, i);
+        if (end == -1)
+            return -1;
+        if (end > 0) {
+            i = end;
+            continue;
+        }
+        if (strchr(set, str[i]) != NULL)
+            return i;
+    }
+    return -1;
+}
+
+bool subst_any(char **input)
+{
+    for (int i = 0; input[i] != NULL; i++) {
+        if (input[i][subst_next(input[i], 0)] != '\0')
+            return true;
+    }
+    return false;
+}
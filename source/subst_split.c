@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** subst_split
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "my.h"
+#include "my_minishell.h"
+
+bool word_vec_push(word_vec_t *vec, char *word)
+{
+    char **words = vec->words;
+
+    if (vec->nb == vec->cap) {
+        vec->cap = vec->cap * 2 + 8;
+        words = realloc(vec->words, sizeof(char *) * vec->cap);
+        if (words == NULL)
+            return false;
+        vec->words = words;
+    }
+    vec->words[vec->nb++] = word;
+    return true;
+}
+
+bool subst_join(arena_t *arena, subst_pend_t *pend, char *str, int len)
+{
+    char *joined = NULL;
+
+    if (pend->str == NULL && str[len] == '\0') {
+        pend->str = str;
+        pend->len = len;
+        return true;
+    }
+    joined = arena_alloc(arena, pend->len + len + 1);
+    if (joined == NULL)
+        return false;
+    memcpy(joined, pend->str, pend->len);
+    memcpy(joined + pend->len, str, len);
+    joined[pend->len + len] = '\0';
+    pend->str = joined;
+    pend->len += len;
+    return true;
+}
+
+/*
+** Cuts the next blank-separated field out of the capture buffer by
+** writing a NUL after it, so fields point straight into the buffer.
+*/
+char *subst_field(char **cursor, int *len)
+{
+    char *field = *cursor + strspn(*cursor, SUBST_IFS);
+
+    if (*field == '\0')
+        return NULL;
+    *len = strcspn(field, SUBST_IFS);
+    *cursor = field + *len;
+    if (**cursor != '\0')
+        (*cursor)++;
+    field[*len] = '\0';
+    return field;
+}
+
+int subst_fields(env_t *env_cpy, char const *body, int len, subst_ctx_t *ctx)
+{
+    subst_out_t out = {NULL, 0};
+    char *cursor = NULL;
+    char *field = NULL;
+    int field_len = 0;
+
+    if (logic_is_blank(body, len))
+        return 0;
+    if (subst_capture(env_cpy, body, len, &out) == -1)
+        return -1;
+    cursor = out.data;
+    field = subst_field(&cursor, &field_len);
+    if (field == NULL)
+        return 0;
+    if (!subst_join(env_cpy->line_arena, &ctx->pend, field, field_len))
+        return -1;
+    while ((field = subst_field(&cursor, &field_len)) != NULL) {
+        if (!word_vec_push(&ctx->vec, ctx->pend.str))
+            return -1;
+        ctx->pend.str = field;
+        ctx->pend.len = field_len;
+    }
+    return 0;
+}
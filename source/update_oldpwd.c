@@ -12,15 +12,14 @@ void update_oldpwd(env_t *env_cpy, char *current_dir)
 {
     int index_value = 0;
     char *new_old_pwd = NULL;
+    env_view_t pwd = env_view(env_cpy, "PWD");
 
     index_value = my_getenv_index("OLDPWD", env_cpy);
     if (index_value == -1) {
-        env_cpy->env_copy = create_new_key(env_cpy, "OLDPWD=");
-        index_value = my_getenv_index("OLDPWD", env_cpy);
-        new_old_pwd = str_concat("OLDPWD=", current_dir);
-        env_cpy->env_copy[index_value] = my_strdup(new_old_pwd);
+        env_append(env_cpy, str_concat("OLDPWD=", current_dir));
     } else {
-        new_old_pwd = str_concat("OLDPWD=", my_getenv("PWD", env_cpy));
-        env_cpy->env_copy[index_value] = my_strdup(new_old_pwd);
+        new_old_pwd = str_concat("OLDPWD=",
+            (pwd.value == NULL) ? current_dir : pwd.value);
+        env_entry_set(env_cpy, index_value, new_old_pwd);
     }
 }
@@ -14,18 +14,9 @@ void update_pwd(env_t *env_cpy, char *current_dir)
     char *new_pwd = NULL;
 
     index_value = my_getenv_index("PWD", env_cpy);
-    if (index_value == -1) {
-        env_cpy->env_copy = create_new_key(env_cpy, "PWD=");
-        index_value = my_getenv_index("PWD", env_cpy);
-        MY_FREE(env_cpy->env_copy[index_value]);
-        new_pwd = str_concat("PWD=", current_dir);
-        env_cpy->env_copy[index_value] = my_strdup(new_pwd);
-        MY_FREE(new_pwd);
-    } else {
-        index_value = my_getenv_index("PWD", env_cpy);
-        MY_FREE(env_cpy->env_copy[index_value]);
-        new_pwd = str_concat("PWD=", current_dir);
-        env_cpy->env_copy[index_value] = my_strdup(new_pwd);
-        MY_FREE(new_pwd);
-    }
+    new_pwd = str_concat("PWD=", current_dir);
+    if (index_value == -1)
+        env_append(env_cpy, new_pwd);
+    else
+        env_entry_set(env_cpy, index_value, new_pwd);
 }
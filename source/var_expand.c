@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** var_expand
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int var_undefined(var_ref_t *ref, char *out)
+{
+    if (out != NULL)
+        return -1;
+    if (ref->kind == VAR_BAD_BRACE) {
+        my_putstr_err("Missing }.\n");
+        return -1;
+    }
+    write(2, ref->name, ref->len);
+    my_putstr_err(": Undefined variable.\n");
+    return -1;
+}
+
+/*
+** $status is tcsh's name for $?, unless the user set a variable of that
+** name.
+*/
+bool var_is_status(var_ref_t *ref, env_t *env_cpy)
+{
+    if (ref->kind == VAR_STATUS)
+        return true;
+    if (ref->kind != VAR_PLAIN || ref->len != 6 ||
+        my_strncmp(ref->name, "status", 6) != 0)
+        return false;
+    return var_lookup(env_cpy, ref->name, ref->len) == NULL;
+}
+
+int var_ref_expand(var_ref_t *ref, env_t *env_cpy, char *out)
+{
+    char *value = NULL;
+    int len = 0;
+
+    if (ref->kind == VAR_LITERAL && out != NULL)
+        out[0] = '$';
+    if (ref->kind == VAR_LITERAL)
+        return 1;
+    if (var_is_status(ref, env_cpy))
+        return my_nbr_to_str(env_cpy->last_status, out);
+    if (ref->kind == VAR_PID)
+        return my_nbr_to_str(getpid(), out);
+    if (ref->kind != VAR_BAD_BRACE)
+        value = var_lookup(env_cpy, ref->name, ref->len);
+    if (ref->kind == VAR_DEFINED)
+        return my_nbr_to_str(value != NULL, out);
+    if (value == NULL)
+        return var_undefined(ref, out);
+    if (ref->kind == VAR_COUNT)
+        return my_nbr_to_str(count_words(value, " \t"), out);
+    len = my_strlen(value);
+    for (int i = 0; out != NULL && i < len; i++)
+        out[i] = value[i];
+    return len;
+}
+
+int expand_word(char const *word, env_t *env_cpy, char *out)
+{
+    var_ref_t ref;
+    int len = 0;
+    int part = 0;
+
+    for (int i = 0; word[i] != '\0';) {
+        part = (subst_end(word, i) > 0) ? subst_end(word, i) - i + 1 : 1;
+        if (word[i] != '$' || part > 1) {
+            for (int k = 0; out != NULL && k < part; k++)
+                out[len + k] = word[i + k];
+            len += part;
+            i += part;
+            continue;
+        }
+        var_ref_parse(word + i, &ref);
+        part = var_ref_expand(&ref, env_cpy, (out != NULL) ? out + len : NULL);
+        if (part == -1)
+            return -1;
+        len += part;
+        i += ref.consumed;
+    }
+    if (out != NULL)
+        out[len] = '\0';
+    return len;
+}
+
+char **expand_vars(char **input, env_t *env_cpy)
+{
+    int len = 0;
+    char *word = NULL;
+
+    for (int i = 0; input[i] != NULL; i++) {
+        if (str_contain_char(input[i], '$') != 0)
+            continue;
+        len = expand_word(input[i], env_cpy, NULL);
+        if (len == -1)
+            return NULL;
+        word = arena_alloc(env_cpy->line_arena, len + 1);
+        if (word == NULL)
+            return NULL;
+        expand_word(input[i], env_cpy, word);
+        input[i] = word;
+    }
+    return input;
+}
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** var_ref
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+int var_name_len(char const *str)
+{
+    if (is_alpha(str[0]) != 0 && str[0] != '_')
+        return 0;
+    return charset_span(charset_class(CHARSET_NAME), str);
+}
+
+void var_ref_braced(char const *str, var_ref_t *ref)
+{
+    int i = 2;
+
+    if (str[i] == '#') {
+        ref->kind = VAR_COUNT;
+        i++;
+    }
+    ref->name = str + i;
+    ref->len = var_name_len(str + i);
+    if (ref->len == 0 || str[i + ref->len] != '}') {
+        ref->kind = VAR_BAD_BRACE;
+        return;
+    }
+    ref->consumed = i + ref->len + 1;
+}
+
+int var_ref_special(char const *str, var_ref_t *ref)
+{
+    if (str[1] == '$') {
+        ref->kind = VAR_PID;
+        ref->consumed = 2;
+        return 1;
+    }
+    if (str[1] != '?')
+        return 0;
+    ref->len = var_name_len(str + 2);
+    ref->kind = (ref->len > 0) ? VAR_DEFINED : VAR_STATUS;
+    ref->name = str + 2;
+    ref->consumed = 2 + ref->len;
+    return 1;
+}
+
+void var_ref_parse(char const *str, var_ref_t *ref)
+{
+    int offset = 1;
+
+    ref->kind = VAR_PLAIN;
+    ref->name = NULL;
+    ref->len = 0;
+    ref->consumed = 1;
+    if (var_ref_special(str, ref) == 1)
+        return;
+    if (str[1] == '{') {
+        var_ref_braced(str, ref);
+        return;
+    }
+    if (str[1] == '#') {
+        ref->kind = VAR_COUNT;
+        offset = 2;
+    }
+    ref->name = str + offset;
+    ref->len = var_name_len(str + offset);
+    ref->consumed = offset + ref->len;
+    if (ref->len == 0) {
+        ref->kind = VAR_LITERAL;
+        ref->consumed = 1;
+    }
+}
+
+char *var_lookup(env_t *env_cpy, char const *name, int len)
+{
+    char *value = var_get(env_cpy->shell_vars, name, len);
+    int index = 0;
+
+    if (value != NULL)
+        return value;
+    index = env_find(env_cpy, name, len);
+    if (index == -1)
+        return NULL;
+    return env_cpy->env_copy[index] + len + 1;
+}
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2022
+** minishell
+** File description:
+** var_table
+*/
+
+#include <stdlib.h>
+#include "my.h"
+#include "my_minishell.h"
+
+var_table_t *var_table_new(void)
+{
+    var_table_t *table = malloc(sizeof(var_table_t));
+
+    if (table == NULL)
+        return NULL;
+    for (int i = 0; i < VAR_TABLE_SIZE; i++)
+        table->buckets[i] = NULL;
+    table->nb_vars = 0;
+    return table;
+}
+
+var_entry_t *var_find(var_table_t *table, char const *name, int len)
+{
+    var_entry_t *entry = table->buckets[my_hash_n(name, len) %
+        VAR_TABLE_SIZE];
+
+    for (; entry != NULL; entry = entry->next) {
+        if (my_strlen(entry->name) == len &&
+            my_strncmp(entry->name, name, len) == 0)
+            return entry;
+    }
+    return NULL;
+}
+
+char *var_get(var_table_t *table, char const *name, int len)
+{
+    var_entry_t *entry = NULL;
+
+    if (table->nb_vars == 0)
+        return NULL;
+    entry = var_find(table, name, len);
+    return (entry != NULL) ? entry->value : NULL;
+}
+
+void var_set(var_table_t *table, char *name, char *value)
+{
+    int len = my_strlen(name);
+    var_entry_t *entry = var_find(table, name, len);
+    unsigned long bucket = my_hash_n(name, len) % VAR_TABLE_SIZE;
+
+    if (entry != NULL) {
+        MY_FREE(entry->value);
+        entry->value = my_strdup(value);
+        return;
+    }
+    entry = malloc(sizeof(var_entry_t));
+    if (entry == NULL)
+        return;
+    entry->name = my_strdup(name);
+    entry->value = my_strdup(value);
+    entry->next = table->buckets[bucket];
+    table->buckets[bucket] = entry;
+    table->nb_vars++;
+}
+
+void var_unset(var_table_t *table, char *name)
+{
+    int len = my_strlen(name);
+    var_entry_t **link = &table->buckets[my_hash_n(name, len) %
+        VAR_TABLE_SIZE];
+    var_entry_t *entry = NULL;
+
+    for (; *link != NULL; link = &(*link)->next) {
+        if (my_strcmp((*link)->name, name) != 0)
+            continue;
+        entry = *link;
+        *link = entry->next;
+        MY_FREE(entry->name);
+        MY_FREE(entry->value);
+        MY_FREE(entry);
+        table->nb_vars--;
+        return;
+    }
+}
@@ -147,6 +147,7 @@ tests()
     expect_pwd_match "cd /usr/../bin/./../bin/../bin/../../home/../home/../etc/./././././../home/././../home" # Well done mate
     expect_pwd_match "cd ~$USER/Downloads"
     expect_stderr_match "cd ~btyigt" #Unknown user
+    expect_stderr_match $'setenv PATH .\ncd /bin\nls -d /\ncd /\nls' # relative PATH entry follows cd
     WITH_ENV="-i"\
     expect_stderr_match "cd ~" #No $home variable
 
@@ -156,6 +157,89 @@ tests()
         expect_signal_message_match "$i"
         WITHOUT_COREDUMP=1 expect_signal_message_match "$i"
     done
+
+    # GLOBBING
+    expect_stdout_match "echo *"
+    expect_stdout_match "echo /usr/*"
+    expect_stdout_match "echo /?sr"
+    expect_stdout_match "echo /[a-e]*"
+    expect_stdout_match "echo /[!a-e]*"
+    expect_stderr_match "echo /nonexistingfolder*" # No match
+    expect_stdout_match "echo /*/"
+    expect_stdout_match "echo /usr/l*/"
+    expect_stdout_match "echo \\*"
+    expect_stdout_match "echo /u\\sr/\\*"
+
+    # VARIABLES
+    expect_stdout_match "echo \$HOME"
+    expect_stdout_match $'set a = hello\necho $a ${a}world'
+    expect_stdout_match $'set a\necho $?a $?nothere'
+    expect_stdout_match $'ls /nonexistingfolder\necho $?'
+    expect_stderr_match "echo \$nothere" # Undefined variable
+
+    # ALIASES
+    expect_stdout_match $'alias ll ls -a\nll'
+    expect_stdout_match $'alias ls ls -a\nls' # self reference
+    expect_stdout_match $'alias ll ls -a\nalias l ll /\nalias\nl'
+    expect_stderr_match $'alias a b\nalias b a\na' # Alias loop
+    expect_stderr_match $'alias ll ls\nunalias ll\nll'
+
+    # SEPARATORS
+    expect_stdout_match "ls && echo done"
+    expect_stdout_match "ls /nonexistingfolder && echo never"
+    expect_stdout_match "ls /nonexistingfolder || echo failed"
+    expect_stdout_match "ls /nonexistingfolder && echo never || echo failed"
+    expect_stderr_match "ls &&" # Invalid null command
+    expect_stderr_match "|| ls" # Invalid null command
+    expect_exit_code $'ls /nonexistingfolder\nexit' 2
+
+    # SUBSHELLS
+    expect_pwd_match "(cd /)" # cd stays inside the subshell
+    expect_pwd_match "(< /dev/null cd /)" # redirect target is not the command
+    expect_pwd_match "(FOO=1 cd /)" # nor is an assignment word
+    expect_stdout_match $'(echo a; echo b) > /tmp/__minishell_group\ncat /tmp/__minishell_group'
+    expect_stdout_match "(ls /nonexistingfolder) || echo failed"
+    expect_stderr_match "(ls) ls" # Badly placed ()'s
+    expect_stderr_match "(ls" # Too many ('s
+    expect_stdout_match "(echo a; echo b) | wc -l"
+    expect_stdout_match "ls / | (wc -l)"
+    expect_stdout_match "(echo a) | (cat) | (wc -c)"
+    expect_pwd_match "(cd /) | cat" # a group stage runs in a child
+    expect_stdout_match "(wc -l) < /etc/passwd"
+    expect_stdout_match $'(cat; echo done) << EOF\none\ntwo\nEOF'
+    expect_stderr_match "(cat) < /nonexistingfile"
+    expect_stderr_match "echo (a) | cat" # Badly placed ()'s
+
+    # WHITESPACE
+    expect_stdout_match $'\techo\ta\t\tb\t' # tabs only
+    expect_stdout_match $'echo a \t  \t b\t \tc' # mixed separator runs
+    expect_stdout_match $'  \t echo  leading  and  trailing \t  ' # trimmed
+    expect_stdout_match $'  \t echo a \t | \t wc   -w \t ' # around a pipe
+    expect_stdout_match $'echo a\t \t>\t/tmp/__minishell_ws ; cat /tmp/__minishell_ws'
+    expect_stdout_match $' \t \t ' # separators only
+    expect_stderr_match $' \t \t ' # separators only
+
+    # PIPELINES
+    expect_stdout_match "ls / | sort -r | head -3"
+    expect_stdout_match "wc -l < /etc/passwd"
+    expect_stdout_match "cat /etc/passwd | wc -l"
+    expect_stderr_match "ls | | wc" # Invalid null command
+    expect_stderr_match "ls > /tmp/__minishell_pipe | wc" # Ambiguous output redirect
+
+    # TIMEOUT
+    expect_stdout_match "timeout 5 ls /"
+    expect_exit_code $'timeout 0.2 sleep 3\nexit' 124
+
+    # BATCH
+    expect_exit_code $'ls / | batch -n 4 echo\nexit' 0
+    expect_exit_code $'ls / | batch false\nexit' 123
+    expect_exit_code $'batch -P 0 -g /* -- ls\nexit' 1
+
+    # COMMAND SUBSTITUTION
+    expect_stdout_match "echo \`ls\`"
+    expect_stdout_match "echo x\`echo a b\`y"
+    expect_stdout_match "ls \`echo /\` | wc -l"
+    expect_stderr_match "echo \`ls" # Unmatched `
 }
 
 